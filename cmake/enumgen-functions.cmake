@@ -2,12 +2,81 @@
 
 
 # Generate enum code files for given input and config files
+#
+#   enumgen_generate(<input_file> <config_file> [TARGET <target>] [BUILD_TIME] [JOBS <count>])
+#
+# By default enums are generated at configure time, the generated files are added to the sources of TARGET when given
+# and are set in ENUMGEN_HEADERS and ENUMGEN_SOURCES in the calling scope. With BUILD_TIME the enums are generated by a
+# build step that is added to the sources of TARGET and reruns whenever the specification, config or templates change
 function(enumgen_generate input_file config_file)
+    cmake_parse_arguments(PARSE_ARGV 2 ENUMGEN "BUILD_TIME" "TARGET;JOBS" "")
+
     get_target_property(ENUMGEN_EXE enumgen::enumgen LOCATION)
 
     set(ENUMGEN_OUTPUT_DIR ${CMAKE_CURRENT_BINARY_DIR})
 
+    set(ENUMGEN_OPTIONS)
+    if(DEFINED ENUMGEN_JOBS)
+        list(APPEND ENUMGEN_OPTIONS "--jobs=${ENUMGEN_JOBS}")
+    endif()
+
+    if(NOT ENUMGEN_BUILD_TIME)
+        execute_process(
+            COMMAND ${ENUMGEN_EXE} ${input_file} ${config_file} ${ENUMGEN_OUTPUT_DIR} ${ENUMGEN_OPTIONS}
+            RESULT_VARIABLE ENUMGEN_RESULT
+        )
+
+        if(NOT ENUMGEN_RESULT EQUAL 0)
+            message(FATAL_ERROR "enumgen_generate: unable to generate enums from ${input_file}")
+        endif()
+
+        # Written by enumgen with exactly the generated files, which avoids globbing the output directory
+        set(ENUMGEN_SOURCES_INCLUDE "${ENUMGEN_OUTPUT_DIR}/enumgen_sources.cmake")
+        if(EXISTS ${ENUMGEN_SOURCES_INCLUDE})
+            include(${ENUMGEN_SOURCES_INCLUDE})
+        endif()
+
+        if(ENUMGEN_TARGET)
+            target_sources(${ENUMGEN_TARGET} PRIVATE ${ENUMGEN_SOURCES})
+        endif()
+
+        set(ENUMGEN_HEADERS ${ENUMGEN_HEADERS} PARENT_SCOPE)
+        set(ENUMGEN_SOURCES ${ENUMGEN_SOURCES} PARENT_SCOPE)
+        return()
+    endif()
+
+    if(NOT ENUMGEN_TARGET)
+        message(FATAL_ERROR "enumgen_generate: BUILD_TIME requires a TARGET for the generated sources")
+    endif()
+
+    # The generated files must be known at configure time to be declared as build outputs, they are listed without
+    # rendering. The build step rewrites the list only when the files it generates change, so the list rather than the
+    # specification or config is the configure dependency and edits that keep the same files only rerun the build step
+    set(ENUMGEN_LIST_FILE "${ENUMGEN_OUTPUT_DIR}/enumgen.outputs")
+    set(ENUMGEN_DEPFILE "${ENUMGEN_OUTPUT_DIR}/enumgen.d")
+
     execute_process(
-        COMMAND ${ENUMGEN_EXE} ${input_file} ${config_file} ${ENUMGEN_OUTPUT_DIR}
+        COMMAND ${ENUMGEN_EXE} ${input_file} ${config_file} ${ENUMGEN_OUTPUT_DIR} "--list-outputs=${ENUMGEN_LIST_FILE}"
+        RESULT_VARIABLE ENUMGEN_RESULT
     )
+
+    if(NOT ENUMGEN_RESULT EQUAL 0)
+        message(FATAL_ERROR "enumgen_generate: unable to list the outputs of ${input_file}")
+    endif()
+
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${ENUMGEN_LIST_FILE})
+
+    file(STRINGS ${ENUMGEN_LIST_FILE} ENUMGEN_OUTPUTS)
+
+    add_custom_command(
+        OUTPUT ${ENUMGEN_OUTPUTS}
+        COMMAND enumgen::enumgen ${input_file} ${config_file} ${ENUMGEN_OUTPUT_DIR}
+            "--depfile=${ENUMGEN_DEPFILE}" "--outputs=${ENUMGEN_LIST_FILE}" ${ENUMGEN_OPTIONS}
+        DEPENDS ${input_file} ${config_file}
+        DEPFILE ${ENUMGEN_DEPFILE}
+        COMMENT "Generating enums from ${input_file}"
+        VERBATIM
+    )
+
+    target_sources(${ENUMGEN_TARGET} PRIVATE ${ENUMGEN_OUTPUTS})
 endfunction()
\ No newline at end of file
@@ -0,0 +1,118 @@
+#include <example/LogTargets.h>
+#include <example/Verbosity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+using namespace example;
+using namespace std::string_view_literals;
+
+
+namespace
+{
+
+    /// <summary>
+    /// Builds a column of strings drawn from the given strings, with every letter's case flipped at random
+    /// </summary>
+    std::vector<std::string> makeColumn(std::vector<std::string_view> const & strings, std::size_t size)
+    {
+        auto engine = std::mt19937(42u);
+        auto pick = std::uniform_int_distribution<std::size_t>(0ul, strings.size() - 1ul);
+        auto flip = std::bernoulli_distribution(0.5);
+
+        auto column = std::vector<std::string>();
+        column.reserve(size);
+
+        for (auto index = 0ul; index < size; ++index)
+        {
+            auto str = std::string(strings[pick(engine)]);
+            for (auto & c : str)
+            {
+                if (flip(engine) && ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')))
+                {
+                    c = static_cast<char>(c ^ 0x20);
+                }
+            }
+
+            column.push_back(std::move(str));
+        }
+
+        return column;
+    }
+
+    /// <summary>
+    /// Runs the function for the given number of repetitions, and prints the fastest time per string
+    /// </summary>
+    template <typename Function>
+    void measure(std::string_view name, std::size_t strings, std::size_t repetitions, Function && function)
+    {
+        using clock = std::chrono::steady_clock;
+        using nanoseconds = std::chrono::duration<double, std::nano>;
+
+        auto fastest = nanoseconds::max();
+        for (auto repetition = 0ul; repetition < repetitions; ++repetition)
+        {
+            auto start = clock::now();
+            function();
+            fastest = std::min(fastest, nanoseconds(clock::now() - start));
+        }
+
+        std::cout << std::format("  {:<40} {:>8.2f} ns per string\n", name, fastest.count() / strings);
+    }
+
+    /// <summary>
+    /// Compares parsing a column one string at a time with TryParse against a single ParseBatch call
+    /// </summary>
+    template <typename Enum>
+    void compare(std::vector<std::string_view> const & strings)
+    {
+        constexpr auto size = 1ul << 20u;
+        constexpr auto repetitions = 10ul;
+
+        auto column = makeColumn(strings, size);
+        auto in = std::vector<std::string_view>(column.begin(), column.end());
+        auto out = std::vector<Enum>(size, Enum::Values().front());
+        auto ok = std::vector<std::uint8_t>(size);
+
+        std::cout << std::format("{}\n", Enum::Name());
+
+        measure("TryParse", size, repetitions, [&]() {
+            for (auto index = 0ul; index < size; ++index)
+            {
+                auto result = Enum::TryParse(in[index]);
+                out[index] = result.value_or(Enum(typename Enum::ValuesType{}));
+                ok[index] = result.has_value() ? 1u : 0u;
+            }
+        });
+
+        auto scalar = out;
+
+        measure("ParseBatch", size, repetitions, [&]() { Enum::ParseBatch(in, out, ok); });
+
+        if (!std::equal(scalar.begin(), scalar.end(), out.begin()))
+        {
+            std::cout << "  ParseBatch disagrees with TryParse\n";
+        }
+    }
+
+}  // namespace
+
+
+int main()
+{
+    std::cout << "enumgen example benchmarks\n\n";
+
+    compare<Verbosity>({ "Quite"sv, "Minimal"sv, "Normal"sv, "Detailed"sv, "Diagnostic"sv, "Verbose"sv });
+    compare<LogTargets>({ "None"sv, "Console"sv, "File"sv, "Network"sv, "Console|File"sv, "Syslog"sv });
+
+    return 0;
+}
\ No newline at end of file
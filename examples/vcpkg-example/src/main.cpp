@@ -1,7 +1,12 @@
+#include <enumgen/Registry.h>
+#include <example/LogTargets.h>
 #include <example/Verbosity.h>
 
+#include <array>
+#include <cstdint>
 #include <format>
 #include <iostream>
+#include <span>
 #include <string_view>
 #include <vector>
 
@@ -10,6 +15,24 @@ using namespace example;
 using namespace std::string_view_literals;
 
 
+/// <summary>
+/// Prints the items of any generated enum from its traits
+/// </summary>
+template <typename Enum>
+void printItems()
+{
+    using Traits = enumgen::enum_traits<Enum>;
+
+    std::cout << std::format("  {} has {} items from {} to {}:", Enum::Name(), Traits::size, Traits::min, Traits::max);
+    for (auto item : Traits::names)
+    {
+        std::cout << std::format(" {}", item);
+    }
+
+    std::cout << "\n";
+}
+
+
 int main()
 {
     std::cout << "enumgen example\n\n";
@@ -18,10 +41,16 @@ int main()
 
     for (auto const & verbosity : Verbosity::Values())
     {
-        std::cout << std::format("  {}::{} = {}\n", Verbosity::Name(), verbosity.ToString(), verbosity.ToUnderlying());
+        std::cout << std::format("  {}::{:b}\n", Verbosity::Name(), verbosity);
     }
 
 
+    std::cout << "\n\nTraits:\n";
+
+    printItems<Verbosity>();
+    printItems<LogTargets>();
+
+
     std::cout << "\n\nParse strings:\n";
 
     auto strings = std::vector{ "QUITE"sv, "Minimal"sv, "normal"sv, "Detailed"sv, "Diagnostic"sv, "not-a-verbosity"sv };
@@ -31,7 +60,7 @@ int main()
         auto parseResult = Verbosity::TryParse(str);
         if (parseResult)
         {
-            std::cout << std::format("  {} parses to {}::{}\n", str, Verbosity::Name(), parseResult->ToString());
+            std::cout << std::format("  {} parses to {}::{}\n", str, Verbosity::Name(), *parseResult);
         }
         else
         {
@@ -39,13 +68,58 @@ int main()
             {
                 std::ignore = Verbosity::Parse(str);
             }
-            catch (std::exception const & ex)
+            catch (VerbosityParseException const & ex)
             {
-                std::cout << std::format("  {} does not parse with exception:\n    {}\n", str, ex.what());
+                std::cout << std::format(
+                    "  {} does not parse with exception:\n    {} ({} characters)\n", str, ex.what(), ex.Length());
             }
         }
     }
 
 
+    std::cout << "\n\nFlags:\n";
+
+    auto targets = LogTargets::TryParse("console | FILE"sv).value_or(+LogTargets::None);
+    targets |= LogTargets::Network;
+
+    auto buffer = std::array<char, LogTargets::MaxStringSize>();
+    std::cout << std::format("  {}::{} = {}\n", LogTargets::Name(), targets.ToString(buffer), targets.ToUnderlying());
+
+    targets.ForEachSet([](LogTargets target) { std::cout << std::format("    {}\n", target); });
+
+
+    std::cout << "\n\nEncoding:\n";
+
+    auto detailed = +Verbosity::Detailed;
+    auto bytes = std::array<std::uint8_t, Verbosity::MaxVarintSize>();
+    auto encoded = std::span<std::uint8_t const>(bytes.data(), detailed.EncodeVarint(bytes));
+    std::cout << std::format("  {} encodes to {} in {} bytes\n", detailed, +detailed.Encode(), encoded.size());
+
+    if (auto decoded = Verbosity::DecodeVarint(encoded))
+    {
+        std::cout << std::format("  which decodes to {}\n", *decoded);
+    }
+
+    for (auto raw : { 3, 7 })
+    {
+        auto verbosity = Verbosity::TryFromUnderlying(raw);
+        std::cout << std::format("  {} is {}\n", raw, verbosity ? verbosity->ToString() : "not a Verbosity"sv);
+    }
+
+
+    std::cout << "\n\nRegistry:\n";
+
+    for (auto const & enumeration : enumgen::registry::Enums())
+    {
+        std::cout << std::format("  {} has {} items\n", enumeration.name, enumeration.itemsByName.size());
+    }
+
+    if (auto verbosity = enumgen::registry::FindEnum("example::Verbosity"sv))
+    {
+        auto item = enumgen::registry::FindValue(*verbosity, 3);
+        std::cout << std::format("  {} with value 3 is {}\n", verbosity->name, item ? item->name : "missing"sv);
+    }
+
+
     return 0;
 }
\ No newline at end of file
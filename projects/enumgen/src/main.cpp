@@ -1,28 +1,53 @@
 #include <enumgen/Config.hpp>
 #include <enumgen/Enums.hpp>
 #include <enumgen/Version.hpp>
+#include <enumgen/utils/Commands.hpp>
+#include <enumgen/utils/Parser.hpp>
 
 #include <fmt/printf.h>
+#include <fmt/ranges.h>
 #include <fmt/std.h>
 
+#include <span>
+
 
 void showUsage()
 {
-    fmt::print("usage: enumgen <inputFile> <configFile> <outputPath>\n");
+    fmt::print("usage: enumgen <inputFile>... <configFile> <outputPath> [options]\n");
+    fmt::print("\n");
+    fmt::print("options:\n");
+    fmt::print("    -j, --jobs <count>           Number of enums rendered in parallel, 0 uses all hardware threads\n");
+    fmt::print("    -f, --force                  Regenerates every enum, ignoring the fingerprint cache\n");
+    fmt::print("    -d, --depfile <file>         Writes a Make style depfile for the generated files\n");
+    fmt::print("    -l, --list-outputs <file>    Writes the files that would be generated without rendering\n");
+    fmt::print("    -o, --outputs <file>         Writes the generated files when they differ from the previous list\n");
+    fmt::print("    -n, --prune-dry-run          Reports stale files that would be pruned without deleting them\n");
+    fmt::print("    -s, --stream                 Renders each enum as soon as it is parsed to bound memory use\n");
 }
 
 
-int generate([[maybe_unused]] int argc, char ** argv)
+int generate(std::span<std::string_view const> positionals, std::span<std::string_view> optionArgs)
 {
-    auto inputFile = std::string_view(argv[1ul], std::strlen(argv[1ul]));
-    auto configFile = std::string_view(argv[2ul], std::strlen(argv[2ul]));
-    auto outputPath = std::string_view(argv[3ul], std::strlen(argv[3ul]));
+    auto inputFiles = positionals.first(positionals.size() - 2ul);
+    auto configFile = positionals[positionals.size() - 2ul];
+    auto outputPath = positionals[positionals.size() - 1ul];
+
+    auto tokenIndex = static_cast<int>(positionals.size() + 1ul);
+    auto options = enumgen::parseCommand<enumgen::GenerateOptions>(enumgen::Tokens(tokenIndex, optionArgs));
+    if (!options)
+    {
+        auto const & error = options.error();
+        auto token = error.input.any() ? error.input.front() : ""sv;
+        fmt::print("Error: {} '{}'\n", error.error, token);
+        showUsage();
+        return -1;
+    }
 
     try
     {
-        fmt::print("generate: {}  {}  {}", inputFile, configFile, outputPath);
+        fmt::print("generate: {}  {}  {}", fmt::join(inputFiles, " "), configFile, outputPath);
 
-        auto result = enumgen::generateEnums(inputFile, configFile, outputPath);
+        auto result = enumgen::generateEnums(inputFiles, configFile, outputPath, *options);
         if (!result)
         {
             return -1;
@@ -50,9 +75,19 @@ int main(int argc, char ** argv)
         }
     }
 
-    if (argc == 4)
+    // Positional arguments run up to the first option, absolute paths can begin with '/' so only '-' marks an option
+    auto args = enumgen::preprocess(argc, argv);
+    auto positionalCount = 0ul;
+    while (positionalCount + 1ul < args.size() && !args[positionalCount + 1ul].starts_with('-'))
+    {
+        ++positionalCount;
+    }
+
+    if (positionalCount >= 3ul)
     {
-        return generate(argc, argv);
+        auto positionals = std::span<std::string_view const>{ args }.subspan(1ul, positionalCount);
+        auto optionArgs = std::span{ args }.subspan(positionalCount + 1ul);
+        return generate(positionals, optionArgs);
     }
 
     showUsage();
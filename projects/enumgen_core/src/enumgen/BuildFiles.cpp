@@ -0,0 +1,163 @@
+#include <enumgen/BuildFiles.hpp>
+
+#include <fstream>
+#include <unordered_set>
+
+
+using namespace std::filesystem;
+
+
+namespace enumgen
+{
+    namespace
+    {
+
+        void appendEscaped(std::string & output, path const & file)
+        {
+            // Make and Ninja both read depfiles with Make escaping rules, forward slashes avoid backslash escapes
+            for (auto c : file.lexically_normal().generic_string())
+            {
+                switch (c)
+                {
+                case ' ':
+                case '#': output.push_back('\\'); break;
+                case '$': output.push_back('$'); break;
+                default: break;
+                }
+
+                output.push_back(c);
+            }
+        }
+
+        void appendCMakeList(std::string & output, std::string_view variable, std::span<path const> files)
+        {
+            output.append("set(");
+            output.append(variable);
+            output.push_back('\n');
+
+            for (auto const & file : files)
+            {
+                output.append("    \"");
+                for (auto c : file.lexically_normal().generic_string())
+                {
+                    if (c == '"' || c == '\\' || c == '$' || c == ';')
+                    {
+                        output.push_back('\\');
+                    }
+
+                    output.push_back(c);
+                }
+                output.append("\"\n");
+            }
+
+            output.append(")\n");
+        }
+
+    }  // namespace
+
+
+    std::string formatDepfile(std::span<path const> targets, std::span<path const> dependencies)
+    {
+        auto result = std::string();
+
+        for (auto index = 0ul; index < targets.size(); ++index)
+        {
+            if (index != 0ul)
+            {
+                result.append(" \\\n ");
+            }
+
+            appendEscaped(result, targets[index]);
+        }
+
+        result.push_back(':');
+
+        for (auto const & dependency : dependencies)
+        {
+            result.append(" \\\n  ");
+            appendEscaped(result, dependency);
+        }
+
+        result.push_back('\n');
+
+        return result;
+    }
+
+    WriteResult writeDepfile(path const & depfile, std::span<path const> targets, std::span<path const> dependencies)
+    {
+        return writeIfChanged(depfile, formatDepfile(targets, dependencies));
+    }
+
+    WriteResult writeOutputList(path const & listFile, std::span<path const> outputs)
+    {
+        auto content = std::string();
+        for (auto const & output : outputs)
+        {
+            content.append(output.lexically_normal().generic_string());
+            content.push_back('\n');
+        }
+
+        return writeIfChanged(listFile, content);
+    }
+
+    std::vector<path> readOutputList(path const & listFile) noexcept
+    {
+        auto result = std::vector<path>();
+
+        try
+        {
+            auto stream = std::ifstream(listFile, std::ios::in);
+            auto line = std::string();
+            while (std::getline(stream, line))
+            {
+                if (!line.empty())
+                {
+                    result.emplace_back(line);
+                }
+            }
+        }
+        catch (std::exception const &)
+        {
+            result.clear();
+        }
+
+        return result;
+    }
+
+    std::vector<path> staleOutputs(std::span<path const> previous, std::span<path const> current)
+    {
+        auto generated = std::unordered_set<std::string>();
+        for (auto const & output : current)
+        {
+            generated.emplace(output.lexically_normal().generic_string());
+        }
+
+        auto result = std::vector<path>();
+        for (auto const & output : previous)
+        {
+            if (!generated.contains(output.lexically_normal().generic_string()))
+            {
+                result.emplace_back(output);
+            }
+        }
+
+        return result;
+    }
+
+    std::string formatSourcesInclude(std::span<path const> headerFiles, std::span<path const> codeFiles)
+    {
+        auto result = std::string("# Generated by enumgen, do not edit\n\n");
+        appendCMakeList(result, "ENUMGEN_HEADERS", headerFiles);
+        result.push_back('\n');
+        appendCMakeList(result, "ENUMGEN_SOURCES", codeFiles);
+
+        return result;
+    }
+
+    WriteResult writeSourcesInclude(
+        path const & includeFile, std::span<path const> headerFiles, std::span<path const> codeFiles)
+    {
+        return writeIfChanged(includeFile, formatSourcesInclude(headerFiles, codeFiles));
+    }
+
+}  // namespace enumgen
\ No newline at end of file
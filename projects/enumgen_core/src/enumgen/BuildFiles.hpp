@@ -0,0 +1,70 @@
+#pragma once
+
+#include <enumgen/utils/Files.hpp>
+
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// File in the output directory listing every file produced by the last successful run
+    /// </summary>
+    inline constexpr std::string_view manifestFileName = "enumgen.manifest";
+
+    /// <summary>
+    /// CMake script in the output directory that sets ENUMGEN_HEADERS and ENUMGEN_SOURCES to the generated files
+    /// </summary>
+    inline constexpr std::string_view sourcesIncludeFileName = "enumgen_sources.cmake";
+
+    /// <summary>
+    /// Formats a Make style depfile declaring that the targets depend on each of the dependencies
+    /// </summary>
+    [[nodiscard]] std::string formatDepfile(
+        std::span<std::filesystem::path const> targets, std::span<std::filesystem::path const> dependencies);
+
+    /// <summary>
+    /// Writes a Make style depfile that build systems use to rerun generation when any of the dependencies change
+    /// </summary>
+    WriteResult writeDepfile(
+        std::filesystem::path const & depfile,
+        std::span<std::filesystem::path const> targets,
+        std::span<std::filesystem::path const> dependencies);
+
+    /// <summary>
+    /// Writes the output files, one per line, for build systems to declare as outputs of the generation step
+    /// </summary>
+    WriteResult writeOutputList(std::filesystem::path const & listFile, std::span<std::filesystem::path const> outputs);
+
+    /// <summary>
+    /// Reads a list of files written by writeOutputList, a missing or unreadable file results in an empty list
+    /// </summary>
+    [[nodiscard]] std::vector<std::filesystem::path> readOutputList(std::filesystem::path const & listFile) noexcept;
+
+    /// <summary>
+    /// Returns the previous outputs that are no longer generated, in the order of the previous outputs
+    /// </summary>
+    [[nodiscard]] std::vector<std::filesystem::path> staleOutputs(
+        std::span<std::filesystem::path const> previous, std::span<std::filesystem::path const> current);
+
+    /// <summary>
+    /// Formats a CMake script that sets ENUMGEN_HEADERS and ENUMGEN_SOURCES to the given files
+    /// </summary>
+    [[nodiscard]] std::string formatSourcesInclude(
+        std::span<std::filesystem::path const> headerFiles, std::span<std::filesystem::path const> codeFiles);
+
+    /// <summary>
+    /// Writes a CMake script that sets ENUMGEN_HEADERS and ENUMGEN_SOURCES so the generated files can be passed
+    /// straight to target_sources without globbing the output directory
+    /// </summary>
+    WriteResult writeSourcesInclude(
+        std::filesystem::path const & includeFile,
+        std::span<std::filesystem::path const> headerFiles,
+        std::span<std::filesystem::path const> codeFiles);
+
+}  // namespace enumgen
\ No newline at end of file
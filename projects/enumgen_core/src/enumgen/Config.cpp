@@ -1,12 +1,11 @@
 #include <enumgen/Config.hpp>
+#include <enumgen/utils/Files.hpp>
 
 #include <fmt/printf.h>
 #include <fmt/std.h>
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
 
-#include <fstream>
-
 
 using namespace std::filesystem;
 
@@ -48,7 +47,7 @@ namespace enumgen
         {
             logger->debug("Reading config file: {}", configFileFullPath);
 
-            auto const & json = nlohmann::json::parse(std::ifstream{ configFileFullPath, std::ios::in });
+            auto const & json = nlohmann::json::parse(MappedFile(configFileFullPath).view());
 
             config.templatesDirectory = findTemplateDirectory(
                 configFileFullPath,
@@ -67,14 +66,68 @@ namespace enumgen
 
                 logger->debug("Resolved enum header template: {}", config.enumConfig.headerTemplateFile);
 
-                auto codeTemplateName = enumConfigJson.contains("codeTemplateName")
-                                            ? enumConfigJson["codeTemplateName"].get<std::string>()
-                                            : "enum.cpp.inja";
+                config.enumConfig.headerOnly
+                    = enumConfigJson.contains("headerOnly") && enumConfigJson["headerOnly"].get<bool>();
+
+                if (config.enumConfig.headerOnly)
+                {
+                    logger->debug("Generating header only enums");
+                }
+                else
+                {
+                    auto codeTemplateName = enumConfigJson.contains("codeTemplateName")
+                                                ? enumConfigJson["codeTemplateName"].get<std::string>()
+                                                : "enum.cpp.inja";
+
+                    config.enumConfig.codeTemplateFile
+                        = absolute(config.templatesDirectory / codeTemplateName).make_preferred();
+
+                    logger->debug("Resolved enum code template: {}", config.enumConfig.codeTemplateFile);
+                }
+
+                if (enumConfigJson.contains("partialTemplateNames"))
+                {
+                    for (auto const & partialTemplateName : enumConfigJson["partialTemplateNames"])
+                    {
+                        auto const & partialTemplateFile = config.enumConfig.partialTemplateFiles.emplace_back(
+                            absolute(config.templatesDirectory / partialTemplateName.get<std::string>())
+                                .make_preferred());
+
+                        logger->debug("Resolved enum partial template: {}", partialTemplateFile);
+                    }
+                }
+
+                if (enumConfigJson.contains("formatters"))
+                {
+                    config.enumConfig.formatters = enumConfigJson["formatters"].get<std::vector<std::string>>();
+                }
+
+                config.enumConfig.parseExceptions
+                    = !enumConfigJson.contains("parseExceptions") || enumConfigJson["parseExceptions"].get<bool>();
+            }
+
+            if (json.contains("registry"))
+            {
+                auto const & registryConfigJson = json["registry"];
+                auto & registryConfig = config.registryConfig.emplace();
+
+                auto headerTemplateName = registryConfigJson.contains("headerTemplateName")
+                                              ? registryConfigJson["headerTemplateName"].get<std::string>()
+                                              : "registry.h.inja";
+
+                auto codeTemplateName = registryConfigJson.contains("codeTemplateName")
+                                            ? registryConfigJson["codeTemplateName"].get<std::string>()
+                                            : "registry.cpp.inja";
+
+                registryConfig.headerTemplateFile
+                    = absolute(config.templatesDirectory / headerTemplateName).make_preferred();
+                registryConfig.codeTemplateFile = absolute(config.templatesDirectory / codeTemplateName).make_preferred();
 
-                config.enumConfig.codeTemplateFile
-                    = absolute(config.templatesDirectory / codeTemplateName).make_preferred();
+                registryConfig.headerFile = path(registryConfigJson["headerPath"].get<std::string>()).make_preferred();
+                registryConfig.codeFile = path(registryConfigJson["codePath"].get<std::string>()).make_preferred();
 
-                logger->debug("Resolved enum code template: {}", config.enumConfig.codeTemplateFile);
+                logger->debug("Resolved registry header template: {}", registryConfig.headerTemplateFile);
+                logger->debug("Resolved registry code template: {}", registryConfig.codeTemplateFile);
             }
 
             return config;
@@ -103,11 +156,44 @@ namespace enumgen
                 success = false;
             }
 
-            if (!exists(config.enumConfig.codeTemplateFile))
+            if (!config.enumConfig.headerOnly && !exists(config.enumConfig.codeTemplateFile))
             {
                 fmt::print("Enum code template not found:\n    {}\n", config.enumConfig.codeTemplateFile);
                 success = false;
             }
+
+            for (auto const & partialTemplateFile : config.enumConfig.partialTemplateFiles)
+            {
+                if (!exists(partialTemplateFile))
+                {
+                    fmt::print("Enum partial template not found:\n    {}\n", partialTemplateFile);
+                    success = false;
+                }
+            }
+        }
+
+        if (config.registryConfig)
+        {
+            if (!exists(config.registryConfig->headerTemplateFile))
+            {
+                fmt::print("Registry header template not found:\n    {}\n", config.registryConfig->headerTemplateFile);
+                success = false;
+            }
+
+            if (!exists(config.registryConfig->codeTemplateFile))
+            {
+                fmt::print("Registry code template not found:\n    {}\n", config.registryConfig->codeTemplateFile);
+                success = false;
+            }
+        }
+
+        for (auto const & formatter : config.enumConfig.formatters)
+        {
+            if (formatter != "std" && formatter != "fmt")
+            {
+                fmt::print("Unknown enum formatter '{}', expected 'std' or 'fmt'\n", formatter);
+                success = false;
+            }
         }
 
         return success;
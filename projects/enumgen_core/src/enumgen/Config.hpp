@@ -3,6 +3,7 @@
 #include <filesystem>
 #include <optional>
 #include <string>
+#include <vector>
 
 
 namespace enumgen
@@ -14,7 +15,47 @@ namespace enumgen
     struct EnumConfig final
     {
         std::filesystem::path headerTemplateFile;
+
+        /// <summary>
+        /// Template for the code file of each enum, empty when generating header only enums
+        /// </summary>
         std::filesystem::path codeTemplateFile;
+
+        /// <summary>
+        /// Templates registered for inja includes before the header and code templates are parsed, so they are
+        /// tracked by fingerprints and depfiles
+        /// </summary>
+        std::vector<std::filesystem::path> partialTemplateFiles;
+
+        /// <summary>
+        /// Generates only headers, with every accessor defined inline in the header
+        /// </summary>
+        bool headerOnly = false;
+
+        /// <summary>
+        /// Formatting libraries to generate formatter specialisations for, each of 'std' or 'fmt'
+        /// </summary>
+        std::vector<std::string> formatters;
+
+        /// <summary>
+        /// Generates a dedicated parse exception for each enum, along with the throwing Parse and string constructor
+        /// </summary>
+        bool parseExceptions = true;
+    };
+
+    /// <summary>
+    /// Config of the registry of every generated enum, rendered once per run after all enums
+    /// </summary>
+    struct RegistryConfig final
+    {
+        std::filesystem::path headerTemplateFile;
+        std::filesystem::path codeTemplateFile;
+
+        /// <summary>
+        /// Generated registry files, relative to the output directory
+        /// </summary>
+        std::filesystem::path headerFile;
+        std::filesystem::path codeFile;
     };
 
     /// <summary>
@@ -25,6 +66,7 @@ namespace enumgen
         std::filesystem::path configFile;
         std::filesystem::path templatesDirectory;
         EnumConfig enumConfig;
+        std::optional<RegistryConfig> registryConfig;
     };
 
 
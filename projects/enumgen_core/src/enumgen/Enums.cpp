@@ -1,20 +1,36 @@
+#include <enumgen/BuildFiles.hpp>
 #include <enumgen/Enums.hpp>
+#include <enumgen/Fingerprints.hpp>
 #include <enumgen/Logging.hpp>
+#include <enumgen/Specification.hpp>
+#include <enumgen/Templates.hpp>
+#include <enumgen/Validation.hpp>
+#include <enumgen/Version.hpp>
+#include <enumgen/analysis/Analysis.hpp>
+#include <enumgen/analysis/Registry.hpp>
+#include <enumgen/utils/Hash.hpp>
+#include <enumgen/utils/ThreadPool.hpp>
 
 #include <fmt/core.h>
 #include <fmt/format.h>
 #include <fmt/printf.h>
+#include <fmt/ranges.h>
 #include <fmt/std.h>
 #include <inja/inja.hpp>
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
 #include <filesystem>
-#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <thread>
 #include <vector>
 
 
-using namespace fmt::literals;
 using namespace nlohmann;
 using namespace std::filesystem;
 using namespace std::string_view_literals;
@@ -30,403 +46,872 @@ namespace enumgen
         static constexpr std::string_view enumsField = "enums"sv;
 
         static constexpr std::string_view nameField = "name"sv;
-        static constexpr std::string_view descriptionField = "description"sv;
         static constexpr std::string_view headerPathField = "headerPath"sv;
         static constexpr std::string_view codePathField = "codePath"sv;
-        static constexpr std::string_view includePathField = "includePath"sv;
-        static constexpr std::string_view namespaceField = "namespace"sv;
-        static constexpr std::string_view underlyingTypeField = "underlyingType"sv;
-        static constexpr std::string_view defaultField = "default"sv;
 
-        static constexpr std::string_view itemsArray = "items"sv;
-        static constexpr std::string_view itemNameField = "name"sv;
-        static constexpr std::string_view itemValueField = "value"sv;
-        static constexpr std::string_view itemStringField = "string"sv;
-        static constexpr std::string_view itemAltsArray = "alts"sv;
-
-        struct requirement final
+        path resolveHeaderFile(
+            path const & root, json const & inputData, json const & description, std::string_view name)
         {
-            std::function<bool(json const &)> check;
-            std::string errorMessage;
-        };
+            auto directory = [&]() {
+                if (inputData.contains(headerRootField))
+                {
+                    return root / inputData[headerRootField].get<std::string>()
+                           / description[headerPathField].get<std::string>();
+                }
 
-        using errors = std::vector<std::string>;
-        using requirements = std::vector<requirement>;
+                return root / description[headerPathField].get<std::string>();
+            }();
 
-        bool required(
-            json const & node,
-            std::string_view name,
-            std::string_view field,
-            std::string missingMessage,
-            requirements requirements,
-            errors & errors) noexcept
-        {
-            if (!node.contains(field))
+            directory = absolute(std::move(directory)).make_preferred();
+
+            if (!exists(directory))
             {
-                errors.emplace_back(
-                    fmt::vformat(missingMessage, fmt::make_format_args("name"_a = name, "field"_a = field)));
-                return false;
+                create_directories(directory);
             }
 
-            auto const & value = node[field];
-            for (auto const & requirement : requirements)
-            {
-                if (!requirement.check(value))
+            return directory / fmt::format("{}.h", name);
+        }
+
+        path resolveCodeFile(path const & root, json const & inputData, json const & description, std::string_view name)
+        {
+            auto directory = [&]() {
+                if (inputData.contains(codeRootField))
                 {
-                    errors.emplace_back(fmt::vformat(
-                        requirement.errorMessage,
-                        fmt::make_format_args("name"_a = name, "field"_a = field)));
-                    return false;
+                    return root / inputData[codeRootField].get<std::string>()
+                           / description[codePathField].get<std::string>();
                 }
+
+                return root / description[codePathField].get<std::string>();
+            }();
+
+            directory = absolute(std::move(directory)).make_preferred();
+
+            if (!exists(directory))
+            {
+                create_directories(directory);
             }
 
-            return true;
+            return directory / fmt::format("{}.cpp", name);
         }
 
-        bool optional(
-            json const & node,
-            std::string_view name,
-            std::string_view field,
-            requirements requirements,
-            errors & errors) noexcept
+        /// <summary>
+        /// Single enum to render along with its resolved output files and result
+        /// </summary>
+        struct EnumJob final
+        {
+            json description;
+            std::string name;
+            path headerFile;
+            path codeFile;
+            std::uint64_t fingerprint = 0ul;
+            std::shared_ptr<spdlog::logger> logger;
+            std::optional<LogBuffer> logs;
+            WriteStats writes = {};
+            bool success = false;
+            std::atomic<bool> done = false;
+        };
+
+        /// <summary>
+        /// Marks a job as done when it goes out of scope, including when rendering throws
+        /// </summary>
+        struct SignalDone final
         {
-            if (!node.contains(field))
+            std::atomic<bool> & done;
+
+            ~SignalDone()
             {
-                return true;
+                done.store(true, std::memory_order_release);
+                done.notify_all();
             }
+        };
 
-            auto success = true;
-            auto const & value = node[field];
-            for (auto const & requirement : requirements)
+        bool generateEnum(
+            TemplateCache & templates,
+            json const & description,
+            path const & headerFile,
+            path const & codeFile,
+            Config const & config,
+            WriteStats & writes,
+            spdlog::logger & logger)
+        {
+            auto name = description[nameField].get<std::string_view>();
+
+            try
             {
-                if (!requirement.check(value))
+                json renderData;
+                renderData["enum"] = description;
+                renderData["analysis"] = analyzeEnum(description);
+                renderData["config"] = { { "headerOnly", config.enumConfig.headerOnly },
+                                         { "formatters", config.enumConfig.formatters },
+                                         { "parseExceptions", config.enumConfig.parseExceptions } };
+
+                for (auto const & partialTemplateFile : config.enumConfig.partialTemplateFiles)
+                {
+                    templates.include(
+                        relative(partialTemplateFile, config.templatesDirectory).generic_string(), partialTemplateFile);
+                }
+
+                logger.info("Generating header for {}", name);
+                logger.debug("    from: {}", config.enumConfig.headerTemplateFile);
+                logger.debug("    to:   {}", headerFile);
+
+                auto headerResult = templates.write(config.enumConfig.headerTemplateFile, renderData, headerFile);
+                if (headerResult == WriteResult::Unchanged)
+                {
+                    logger.debug("    unchanged");
+                }
+
+                writes.record(headerResult);
+
+                if (codeFile.empty())
+                {
+                    return true;
+                }
+
+                logger.info("Generating code for {}", name);
+                logger.debug("   from: {}", config.enumConfig.codeTemplateFile);
+                logger.debug("   to:   {}", codeFile);
+
+                auto codeResult = templates.write(config.enumConfig.codeTemplateFile, renderData, codeFile);
+                if (codeResult == WriteResult::Unchanged)
                 {
-                    errors.emplace_back(fmt::vformat(
-                        requirement.errorMessage,
-                        fmt::make_format_args("name"_a = name, "field"_a = field)));
-                    success = false;
+                    logger.debug("   unchanged");
                 }
+
+                writes.record(codeResult);
+
+                return true;
             }
+            catch (std::exception const & ex)
+            {
+                logger.error("Error generating enum {}: {}", name, ex.what());
+                logger.trace("Cleaning header {}", headerFile);
 
-            return success;
-        }
+                std::error_code error;
+                remove(headerFile, error);
 
-        bool stringNotEmpty(json const & node) noexcept
-        {
-            auto value = node.get<std::string_view>();
-            return !value.empty() && value.size() != 0ul;
+                if (!codeFile.empty())
+                {
+                    logger.trace("Cleaning code {}", codeFile);
+                    remove(codeFile, error);
+                }
+
+                return false;
+            }
         }
 
-        bool allItemsStrings(json const & node) noexcept
+        /// <summary>
+        /// Renders the registry of every enum in the run, a single header and code file regardless of the number of
+        /// enums
+        /// </summary>
+        bool generateRegistry(
+            TemplateCache & templates,
+            std::vector<RegistryEnum> registry,
+            path const & headerFile,
+            path const & codeFile,
+            Config const & config,
+            WriteStats & writes,
+            spdlog::logger & logger)
         {
-            for (auto const & item : node)
+            auto const & registryConfig = *config.registryConfig;
+
+            try
             {
-                if (!item.is_string())
-                {
-                    return false;
-                }
+                json renderData;
+                renderData["registry"] = analyzeRegistry(std::move(registry));
+                renderData["registry"]["headerInclude"] = relative(headerFile, codeFile.parent_path()).generic_string();
+
+                create_directories(headerFile.parent_path());
+                create_directories(codeFile.parent_path());
+
+                logger.info("Generating registry of {} enums", renderData["registry"]["enums"].size());
+                logger.debug("    from: {}", registryConfig.headerTemplateFile);
+                logger.debug("    to:   {}", headerFile);
+
+                writes.record(templates.write(registryConfig.headerTemplateFile, renderData, headerFile));
+
+                logger.debug("    from: {}", registryConfig.codeTemplateFile);
+                logger.debug("    to:   {}", codeFile);
+
+                writes.record(templates.write(registryConfig.codeTemplateFile, renderData, codeFile));
+
+                return true;
             }
+            catch (std::exception const & ex)
+            {
+                logger.error("Error generating registry: {}", ex.what());
+
+                std::error_code error;
+                remove(headerFile, error);
+                remove(codeFile, error);
 
-            return true;
+                return false;
+            }
         }
 
-        void validateItem(std::string_view enumName, json const & node, errors & errors) noexcept
-        {
-            auto hasItemName = required(
-                node,
-                enumName,
-                itemNameField,
-                "Enum '{name}' has item with missing '{field}' field",
-                requirements{ requirement{ &json::is_string, "Enum '{name}' item has non-string '{field}' field" },
-                              requirement{ stringNotEmpty, "Enum '{name}' item has empty string '{field}' field" } },
-                errors);
-
-            if (!hasItemName)
-            {
-                return;
-            }
-
-            auto name = fmt::format("{}::{}", enumName, node[nameField].get<std::string_view>());
-
-            required(
-                node,
-                name,
-                itemStringField,
-                "Enum item '{name}' is missing '{field}' field",
-                requirements{ requirement{ &json::is_string, "Enum item '{name}::{field}' has non-string value" },
-                              requirement{ stringNotEmpty, "Enum item '{name}::{field}' has empty string value" } },
-                errors);
-
-            optional(
-                node,
-                name,
-                itemValueField,
-                requirements{
-                    requirement{ &json::is_number_integer, "Enum item '{name}::{field}' has non-int value" } },
-                errors);
-
-            optional(
-                node,
-                name,
-                itemAltsArray,
-                requirements{ requirement{ &json::is_array, "Enum item '{name}::{field}' has non-array value" },
-                              requirement{ allItemsStrings, "Enum item '{name}::{field}' has non-string values" } },
-                errors);
+        std::size_t resolveWorkerCount(std::size_t jobs) noexcept
+        {
+            if (jobs == 0ul)
+            {
+                jobs = std::thread::hardware_concurrency();
+            }
+
+            return std::max<std::size_t>(jobs, 1ul);
         }
 
-        void validateEnum(json const & node, errors & errors) noexcept
+        /// <summary>
+        /// Per worker template caches along with the pool that runs them, shared by every specification in a run
+        /// </summary>
+        struct Workers final
         {
-            auto hasName = required(
-                node,
-                ""sv,
-                nameField,
-                "Enum description is missing required '{field}' field",
-                requirements{ requirement{ &json::is_string, "Enum description has non-string '{field}' field" },
-                              requirement{ stringNotEmpty, "Enum description has empty '{field}' field" } },
-                errors);
+            std::deque<TemplateCache> templates;
+            std::optional<ThreadPool> pool;
 
-            if (!hasName)
+            Workers(std::size_t workerCount, path const & templatesDirectory)
             {
-                return;
+                for (auto index = 0ul; index < workerCount; ++index)
+                {
+                    templates.emplace_back(templatesDirectory);
+                }
+
+                if (workerCount > 1ul)
+                {
+                    pool.emplace(workerCount);
+                }
             }
 
-            auto name = node[nameField].get<std::string_view>();
+            [[nodiscard]] TemplateStats stats() const noexcept
+            {
+                auto result = TemplateStats{};
+                for (auto const & cache : templates)
+                {
+                    result += cache.stats();
+                }
 
-            constexpr auto requiredFields
-                = std::array{ headerPathField, codePathField, includePathField, namespaceField };
+                return result;
+            }
+        };
 
-            for (auto const & field : requiredFields)
+        /// <summary>
+        /// State shared by every specification generated in a single run
+        /// </summary>
+        struct Run final
+        {
+            Config const & config;
+            GenerateOptions const & options;
+            Workers workers;
+            FingerprintCache fingerprints;
+            std::uint64_t inputsFingerprint = 0ul;
+            WriteStats writes = {};
+            std::size_t skipped = 0ul;
+            std::vector<path> headerFiles = {};
+            std::vector<path> codeFiles = {};
+            std::vector<RegistryEnum> registry = {};
+
+            /// <summary>
+            /// Every file generated by the run, headers followed by code files
+            /// </summary>
+            [[nodiscard]] std::vector<path> outputs() const
             {
-                required(
-                    node,
-                    name,
-                    field,
-                    "Enum '{name}' is missing required '{field}' field",
-                    requirements{ requirement{ &json::is_string, "Enum '{name}::{field}' should hold a string" },
-                                  requirement{ stringNotEmpty, "Enum '{name}::{field}' cannot be empty" } },
-                    errors);
+                auto result = headerFiles;
+                result.insert(result.end(), codeFiles.begin(), codeFiles.end());
+                return result;
             }
+        };
 
-            constexpr auto optionalFields = std::array{ descriptionField, underlyingTypeField, defaultField };
+        /// <summary>
+        /// Fingerprint of the inputs shared by all enums: the enumgen version, the generation mode, the formatters, the
+        /// parse exceptions switch and the template contents
+        /// </summary>
+        std::uint64_t fingerprintInputs(Config const & config)
+        {
+            auto hasher = Hasher();
+            hasher.update(Version)
+                .update(config.enumConfig.headerOnly)
+                .update(fingerprintFile(config.enumConfig.headerTemplateFile));
 
-            for (auto const & field : optionalFields)
+            hasher.update(static_cast<std::uint64_t>(config.enumConfig.formatters.size()));
+            for (auto const & formatter : config.enumConfig.formatters)
             {
-                optional(
-                    node,
-                    name,
-                    field,
-                    requirements{ requirement{ &json::is_string, "Enum '{name}::{field}' should hold a string" },
-                                  requirement{ stringNotEmpty, "Enum '{name}::{field}' cannot be empty" } },
-                    errors);
+                hasher.update(formatter);
             }
 
-            auto hasItems = required(
-                node,
-                name,
-                itemsArray,
-                "Enum '{name}' is missing required '{field}' field",
-                requirements{ requirement{ &json::is_array, "Enum '{name}::field}' is not an array" } },
-                errors);
+            hasher.update(config.enumConfig.parseExceptions);
 
-            if (!hasItems)
+            if (!config.enumConfig.headerOnly)
             {
-                return;
+                hasher.update(fingerprintFile(config.enumConfig.codeTemplateFile));
             }
 
-            for (auto const & item : node[itemsArray])
+            for (auto const & partialTemplateFile : config.enumConfig.partialTemplateFiles)
             {
-                validateItem(name, item, errors);
+                hasher.update(partialTemplateFile.string()).update(fingerprintFile(partialTemplateFile));
             }
+
+            return hasher.digest();
         }
 
-        errors validateEnums(json const & node) noexcept
+        std::uint64_t fingerprintEnum(
+            std::uint64_t inputsFingerprint, json const & description, path const & headerFile, path const & codeFile)
         {
-            errors errors;
+            return Hasher()
+                .update(inputsFingerprint)
+                .update(description.dump())
+                .update(headerFile.string())
+                .update(codeFile.string())
+                .digest();
+        }
 
-            auto hasEnums = required(
-                node,
-                "",
-                enumsField,
-                "'{field}' root node is missing",
-                requirements{ requirement{
-                    &json::is_array,
-                    "'{field}' should contain an array of enum descriptions",
-                } },
-                errors);
+        path resolveInputFile(std::string_view inputFile)
+        {
+            auto result = absolute(path(inputFile)).make_preferred();
 
-            if (!hasEnums)
+            if (!exists(result))
             {
-                return errors;
+                throw std::runtime_error(fmt::format("Input file '{}' does not exist", result));
             }
 
-            for (auto const & description : node[enumsField])
+            return result;
+        }
+
+        path resolveConfigFile(std::string_view configFile)
+        {
+            auto result = absolute(path(configFile)).make_preferred();
+
+            if (!exists(result))
             {
-                validateEnum(description, errors);
+                throw std::runtime_error(fmt::format("Config file '{}' does not exist", result));
             }
 
-            return errors;
+            return result;
         }
 
-        path resolveHeaderFile(
-            path const & root, json const & inputData, json const & description, std::string_view name)
+        path resolveOutputPath(std::string_view outputPath)
         {
-            auto directory = [&]() {
-                if (inputData.contains(headerRootField))
-                {
-                    return root / inputData[headerRootField].get<std::string>()
-                           / description[headerPathField].get<std::string>();
-                }
+            auto result = absolute(path(outputPath)).make_preferred();
 
-                return root / description[headerPathField].get<std::string>();
-            }();
+            if (!exists(result))
+            {
+                create_directories(result);
+            }
 
-            directory = absolute(std::move(directory)).make_preferred();
+            return result;
+        }
 
-            if (!exists(directory))
+        bool writeOutputs(path const & listFile, std::span<path const> outputs) noexcept
+        {
+            auto logger = spdlog::get("logger");
+
+            try
             {
-                create_directories(directory);
+                logger->info("Writing {} outputs to: {}", outputs.size(), listFile);
+                writeOutputList(absolute(listFile), outputs);
+                return true;
+            }
+            catch (std::exception const & ex)
+            {
+                logger->error("Error writing output list: {}", ex.what());
+                return false;
             }
-
-            return directory / fmt::format("{}.h", name);
         }
 
-        path resolveCodeFile(path const & root, json const & inputData, json const & description, std::string_view name)
+        /// <summary>
+        /// Removes outputs of a previous run that are no longer generated, returns the stale outputs that remain
+        /// </summary>
+        std::vector<path> pruneOutputs(
+            std::span<path const> staleFiles, path const & outputRoot, GenerateOptions const & options) noexcept
         {
-            auto directory = [&]() {
-                if (inputData.contains(codeRootField))
+            auto logger = spdlog::get("logger");
+            auto retained = std::vector<path>();
+            auto pruned = 0ul;
+
+            for (auto const & file : staleFiles)
+            {
+                if (!isWithin(file, outputRoot))
                 {
-                    return root / inputData[codeRootField].get<std::string>()
-                           / description[codePathField].get<std::string>();
+                    logger->warn("Not pruning {}, it is outside the output directory", file);
+                    continue;
                 }
 
-                return root / description[codePathField].get<std::string>();
-            }();
+                if (options.pruneDryRun)
+                {
+                    logger->info("Would prune: {}", file);
+                    retained.emplace_back(file);
+                    continue;
+                }
 
-            directory = absolute(std::move(directory)).make_preferred();
+                try
+                {
+                    if (removeFileAndEmptyParents(file, outputRoot))
+                    {
+                        logger->debug("Pruned: {}", file);
+                        ++pruned;
+                    }
+                }
+                catch (std::exception const & ex)
+                {
+                    logger->warn("Unable to prune {}: {}", file, ex.what());
+                    retained.emplace_back(file);
+                }
+            }
 
-            if (!exists(directory))
+            if (options.pruneDryRun)
             {
-                create_directories(directory);
+                logger->info("Files that would be pruned {}", retained.size());
+            }
+            else
+            {
+                logger->info("Files pruned {}", pruned);
             }
 
-            return directory / fmt::format("{}.cpp", name);
+            return retained;
         }
 
-        bool generateEnum(
-            path const & root,
-            inja::Environment & env,
-            json const & inputData,
-            json const & description,
-            Config const & config)
+        /// <summary>
+        /// Writes the files build systems use to consume the generated files: the manifest of produced files, the
+        /// CMake sources include and optionally the depfile
+        /// </summary>
+        bool writeBuildFiles(
+            std::span<path const> inputFiles,
+            path const & outputRoot,
+            Run const & run,
+            std::span<path const> retainedOutputs) noexcept
         {
             auto logger = spdlog::get("logger");
 
-            auto name = description[nameField].get<std::string_view>();
-            auto headerFile = resolveHeaderFile(root, inputData, description, name);
-            auto codeFile = resolveCodeFile(root, inputData, description, name);
-
-            json renderData;
-            renderData["enum"] = description;
-
             try
             {
-                logger->info("Generating header for {}", name);
-                logger->debug("    from: {}", config.enumConfig.headerTemplateFile);
-                logger->debug("    to:   {}", headerFile);
+                auto outputs = run.outputs();
 
-                env.write(config.enumConfig.headerTemplateFile.string(), renderData, headerFile.string());
+                // Stale outputs that were not pruned stay in the manifest so a later run can still prune them
+                auto manifest = outputs;
+                manifest.insert(manifest.end(), retainedOutputs.begin(), retainedOutputs.end());
 
-                logger->info("Generating code for {}", name);
-                logger->debug("   from: {}", config.enumConfig.codeTemplateFile);
-                logger->debug("   to:   {}", codeFile);
+                logger->debug("Writing manifest of {} generated files", manifest.size());
+                writeOutputList(outputRoot / manifestFileName, manifest);
+                writeSourcesInclude(outputRoot / sourcesIncludeFileName, run.headerFiles, run.codeFiles);
 
-                env.write(config.enumConfig.codeTemplateFile.string(), renderData, codeFile.string());
+                if (!run.options.depfile.empty())
+                {
+                    auto dependencies = std::vector<path>(inputFiles.begin(), inputFiles.end());
+                    dependencies.emplace_back(run.config.configFile);
+                    dependencies.emplace_back(run.config.enumConfig.headerTemplateFile);
+
+                    if (!run.config.enumConfig.headerOnly)
+                    {
+                        dependencies.emplace_back(run.config.enumConfig.codeTemplateFile);
+                    }
+
+                    auto const & partials = run.config.enumConfig.partialTemplateFiles;
+                    dependencies.insert(dependencies.end(), partials.begin(), partials.end());
+
+                    if (run.config.registryConfig)
+                    {
+                        dependencies.emplace_back(run.config.registryConfig->headerTemplateFile);
+                        dependencies.emplace_back(run.config.registryConfig->codeTemplateFile);
+                    }
+
+                    // Templates pulled in with inja includes that are not registered as partials are not tracked,
+                    // changes to them need a forced regeneration
+                    logger->info("Writing depfile: {}", run.options.depfile);
+                    writeDepfile(absolute(path(run.options.depfile)), outputs, dependencies);
+                }
 
                 return true;
             }
             catch (std::exception const & ex)
             {
-                logger->error("Error generating enums: {}", ex.what());
-                logger->trace("Cleaning header {}", headerFile);
-                logger->trace("Cleaning code {}", codeFile);
-
-                remove(headerFile);
-                remove(codeFile);
-
+                logger->error("Error writing build files: {}", ex.what());
                 return false;
             }
         }
 
-        path resolveInputFile(std::string_view inputFile)
+        /// <summary>
+        /// Resolves, skips and renders enums one at a time in specification order. With a pool the renders run
+        /// concurrently with a bounded number in flight, and their logs are replayed in specification order
+        /// </summary>
+        class EnumPipeline final
         {
-            auto result = absolute(path(inputFile)).make_preferred();
+        private:
+            Run & run;
+            path const & outputRoot;
+            std::shared_ptr<spdlog::logger> logger;
+            std::deque<std::unique_ptr<EnumJob>> inFlight;
+            std::size_t maxInFlight = 0ul;
+            std::size_t count = 0ul;
+            std::vector<std::string> failed;
+
+        public:
+            EnumPipeline(Run & run, path const & outputRoot)
+              : run(run), outputRoot(outputRoot), logger(spdlog::get("logger"))
+            {
+                if (run.workers.pool && run.options.listOutputs.empty())
+                {
+                    // Enough queued work to keep every worker busy while bounding the descriptions held in memory
+                    maxInFlight = run.workers.pool->size() * 4ul;
+                    logger->info("Rendering enums with {} jobs", run.workers.pool->size());
+                }
+            }
 
-            if (!exists(result))
+            EnumPipeline(EnumPipeline const &) = delete;
+            EnumPipeline & operator=(EnumPipeline const &) = delete;
+
+            ~EnumPipeline()
             {
-                throw std::runtime_error(fmt::format("Input file '{}' does not exist", result));
+                // Only reached with jobs in flight when reading the specification throws part way through
+                for (auto const & job : inFlight)
+                {
+                    job->done.wait(false, std::memory_order_acquire);
+                }
             }
 
-            return result;
-        }
+            void add(json const & rootFields, json description)
+            {
+                // Templates and fingerprints see the values and underlying type the semantic checks validated
+                resolveDescription(description);
 
-        path resolveConfigFile(std::string_view configFile)
-        {
-            auto result = absolute(path(configFile)).make_preferred();
+                auto job = std::make_unique<EnumJob>();
+                job->name = description[nameField].get<std::string>();
+                job->headerFile = resolveHeaderFile(outputRoot, rootFields, description, job->name);
+                if (!run.config.enumConfig.headerOnly)
+                {
+                    job->codeFile = resolveCodeFile(outputRoot, rootFields, description, job->name);
+                }
 
-            if (!exists(result))
+                job->fingerprint
+                    = fingerprintEnum(run.inputsFingerprint, description, job->headerFile, job->codeFile);
+                job->description = std::move(description);
+
+                ++count;
+                run.headerFiles.emplace_back(job->headerFile);
+                if (!job->codeFile.empty())
+                {
+                    run.codeFiles.emplace_back(job->codeFile);
+                }
+
+                if (!run.options.listOutputs.empty())
+                {
+                    return;
+                }
+
+                // Skipped enums are still collected, the registry is rendered in full every run
+                if (run.config.registryConfig)
+                {
+                    if (auto registryEnum = makeRegistryEnum(job->description))
+                    {
+                        run.registry.emplace_back(std::move(*registryEnum));
+                    }
+                    else
+                    {
+                        logger->warn(
+                            "Leaving {} out of the registry, its values do not fit in 64 bits", job->name);
+                    }
+                }
+
+                job->logger = run.workers.pool ? job->logs.emplace().logger() : logger;
+
+                // Enums with the same fingerprint as the previous run and intact outputs do not need rendering
+                auto upToDate = !run.options.force
+                                && run.fingerprints.matches(job->headerFile.string(), job->fingerprint)
+                                && exists(job->headerFile) && (job->codeFile.empty() || exists(job->codeFile));
+
+                if (upToDate)
+                {
+                    job->logger->debug("Skipping {}, inputs are unchanged", job->name);
+                    job->success = true;
+                    job->done = true;
+                    ++run.skipped;
+                }
+                else if (!run.workers.pool)
+                {
+                    auto signal = SignalDone{ job->done };
+                    render(0ul, *job);
+                }
+                else
+                {
+                    run.workers.pool->submit([this, job = job.get()](std::size_t workerIndex) {
+                        auto signal = SignalDone{ job->done };
+                        render(workerIndex, *job);
+                    });
+                }
+
+                inFlight.emplace_back(std::move(job));
+                drain(maxInFlight);
+            }
+
+            void reject(json const & description, std::span<std::string const> errors)
             {
-                throw std::runtime_error(fmt::format("Config file '{}' does not exist", result));
+                // Completed jobs are flushed first so the errors appear in specification order
+                drain(0ul);
+
+                auto name = fmt::format("#{}", count);
+                if (auto it = description.find(nameField); it != description.end() && it->is_string())
+                {
+                    name = it->get<std::string>();
+                }
+
+                logger->error("Errors while validating enum {}", name);
+                for (auto const & message : errors)
+                {
+                    logger->debug("    {}", message);
+                }
+
+                ++count;
+                failed.emplace_back(std::move(name));
             }
 
-            return result;
-        }
+            bool finish()
+            {
+                drain(0ul);
 
-        path resolveOutputPath(std::string_view outputPath)
+                if (run.workers.pool)
+                {
+                    run.workers.pool->wait();
+                }
+
+                if (!failed.empty())
+                {
+                    logger->error(
+                        "Failed to generate {} of {} enums: {}", failed.size(), count, fmt::join(failed, ", "));
+                    return false;
+                }
+
+                return true;
+            }
+
+        private:
+            void render(std::size_t workerIndex, EnumJob & job)
+            {
+                job.success = generateEnum(
+                    run.workers.templates[workerIndex],
+                    job.description,
+                    job.headerFile,
+                    job.codeFile,
+                    run.config,
+                    job.writes,
+                    *job.logger);
+            }
+
+            /// <summary>
+            /// Completes finished jobs from the front of the queue, waiting on the oldest job while more than the
+            /// limit remain in flight
+            /// </summary>
+            void drain(std::size_t limit)
+            {
+                while (!inFlight.empty())
+                {
+                    auto & job = *inFlight.front();
+                    if (!job.done.load(std::memory_order_acquire))
+                    {
+                        if (inFlight.size() <= limit)
+                        {
+                            return;
+                        }
+
+                        job.done.wait(false, std::memory_order_acquire);
+                    }
+
+                    complete(job);
+                    inFlight.pop_front();
+                }
+            }
+
+            void complete(EnumJob & job)
+            {
+                if (job.logs)
+                {
+                    job.logs->replay(*logger);
+                }
+
+                run.writes += job.writes;
+
+                if (!job.success)
+                {
+                    failed.emplace_back(std::move(job.name));
+                    return;
+                }
+
+                run.fingerprints.record(job.headerFile.string(), job.fingerprint);
+            }
+        };
+
+        bool generateSpecification(path const & inputFile, path const & outputRoot, Run & run)
         {
-            auto result = absolute(path(outputPath)).make_preferred();
+            auto logger = spdlog::get("logger");
 
-            if (!exists(result))
+            logger->info("Loading input data from: {}", inputFile);
+            auto input = MappedFile(inputFile);
+            auto pipeline = EnumPipeline(run, outputRoot);
+
+            if (run.options.stream)
             {
-                create_directories(result);
+                auto errors = std::vector<std::string>();
+                streamSpecification(input.view(), [&](json const & rootFields, json && description) {
+                    validateEnum(description, errors);
+                    if (!errors.empty())
+                    {
+                        pipeline.reject(description, errors);
+                        errors.clear();
+                        return;
+                    }
+
+                    pipeline.add(rootFields, std::move(description));
+                });
+
+                return pipeline.finish();
             }
 
-            return result;
+            auto inputData = json::parse(input.view());
+
+            auto validationResults = validateSpecification(inputData);
+            if (!validationResults.empty())
+            {
+                logger->error("Errors while validating enums input");
+
+                for (auto const & message : validationResults)
+                {
+                    logger->debug("    {}", message);
+                }
+
+                return false;
+            }
+
+            for (auto & description : inputData[enumsField])
+            {
+                pipeline.add(inputData, std::move(description));
+            }
+
+            return pipeline.finish();
         }
 
     }  // namespace
 
-    bool generateEnums(path const & inputFile, std::filesystem::path const & outputRoot, Config const & config) noexcept
+    bool generateEnums(
+        path const & inputFile, path const & outputRoot, Config const & config, GenerateOptions const & options) noexcept
+    {
+        return generateEnums(std::span{ &inputFile, 1ul }, outputRoot, config, options);
+    }
+
+    bool generateEnums(
+        std::span<path const> inputFiles,
+        path const & outputRoot,
+        Config const & config,
+        GenerateOptions const & options) noexcept
     {
         auto logger = spdlog::get("logger");
 
-        logger->debug("Input file:          {}", inputFile);
+        for (auto const & inputFile : inputFiles)
+        {
+            logger->debug("Input file:          {}", inputFile);
+        }
+
         logger->debug("Config file:         {}", config.configFile);
         logger->debug("Templates directory: {}", config.templatesDirectory);
         logger->debug("Output directory:    {}", outputRoot);
 
+        auto cacheFile = outputRoot / FingerprintCache::fileName;
+        auto previousOutputs = readOutputList(outputRoot / manifestFileName);
+        auto listedOutputs
+            = options.outputs.empty() ? std::vector<path>() : readOutputList(absolute(path(options.outputs)));
+
         logger->info("Initialize inja templating engine");
-        auto env = inja::Environment();
-        env.set_trim_blocks(true);
+        auto run = Run{ .config = config,
+                        .options = options,
+                        .workers = Workers(resolveWorkerCount(options.jobs), config.templatesDirectory),
+                        .fingerprints = FingerprintCache::load(cacheFile) };
 
-        logger->info("Loading input data from: {}", inputFile);
-        auto inputData = env.load_json(inputFile.string());
+        try
+        {
+            run.inputsFingerprint = fingerprintInputs(config);
+        }
+        catch (std::exception const & ex)
+        {
+            logger->error("Error reading templates: {}", ex.what());
+            return false;
+        }
 
-        auto validationResults = validateEnums(inputData);
-        if (!validationResults.empty())
+        // The registry is listed first so it keeps its place in the outputs when enums are added or removed
+        auto registryHeaderFile = path();
+        auto registryCodeFile = path();
+        if (config.registryConfig)
         {
-            logger->error("Errors while validating enums input");
+            registryHeaderFile = absolute(outputRoot / config.registryConfig->headerFile).make_preferred();
+            registryCodeFile = absolute(outputRoot / config.registryConfig->codeFile).make_preferred();
+            run.headerFiles.emplace_back(registryHeaderFile);
+            run.codeFiles.emplace_back(registryCodeFile);
+        }
 
-            for (auto const & message : validationResults)
+        auto success = true;
+        for (auto const & inputFile : inputFiles)
+        {
+            try
             {
-                logger->debug("    {}", message);
+                success &= generateSpecification(inputFile, outputRoot, run);
             }
+            catch (std::exception const & ex)
+            {
+                logger->error("Error generating enums from {}: {}", inputFile, ex.what());
+                success = false;
+            }
+        }
+
+        // Listing outputs renders nothing so the fingerprint cache is left as it is
+        if (!options.listOutputs.empty())
+        {
+            return success && writeOutputs(path(options.listOutputs), run.outputs());
+        }
+
+        try
+        {
+            run.fingerprints.save(cacheFile);
+        }
+        catch (std::exception const & ex)
+        {
+            logger->warn("Unable to save fingerprint cache: {}", ex.what());
+        }
+
+        // Rendered after every enum so the registry never lists an enum that failed to generate
+        if (success && config.registryConfig)
+        {
+            success = generateRegistry(
+                run.workers.templates[0],
+                std::move(run.registry),
+                registryHeaderFile,
+                registryCodeFile,
+                config,
+                run.writes,
+                *logger);
+        }
+
+        auto stats = run.workers.stats();
+        logger->info("Templates parsed {} times for {} renders", stats.parseCount, stats.renderCount);
+        logger->info("Enums skipped {} with unchanged inputs", run.skipped);
+        logger->info("Files written {}, unchanged {}", run.writes.written, run.writes.unchanged);
 
+        if (!success)
+        {
             return false;
         }
 
-        for (auto const & description : inputData[enumsField])
+        // Outputs of enums removed from the specifications are deleted, their fingerprints were not recorded this run.
+        // Those still in the outputs list may be compiled before the build system rereads it, so they are kept
+        auto staleFiles = staleOutputs(previousOutputs, run.outputs());
+        auto prunableFiles = staleOutputs(staleFiles, listedOutputs);
+        auto retainedOutputs = pruneOutputs(prunableFiles, outputRoot, options);
+        for (auto const & file : staleOutputs(staleFiles, prunableFiles))
         {
-            generateEnum(outputRoot, env, inputData, description, config);
+            logger->info("Not pruning {}, it is still in the outputs list", file);
+            retainedOutputs.emplace_back(file);
+        }
+
+        if (!writeBuildFiles(inputFiles, outputRoot, run, retainedOutputs))
+        {
+            return false;
+        }
+
+        if (!options.outputs.empty() && !writeOutputs(path(options.outputs), run.outputs()))
+        {
+            return false;
         }
 
         logger->info("Templates generated");
@@ -434,7 +919,20 @@ namespace enumgen
         return true;
     }
 
-    bool generateEnums(std::string_view inputFile, std::string_view configFile, std::string_view outputPath) noexcept
+    bool generateEnums(
+        std::string_view inputFile,
+        std::string_view configFile,
+        std::string_view outputPath,
+        GenerateOptions const & options) noexcept
+    {
+        return generateEnums(std::span{ &inputFile, 1ul }, configFile, outputPath, options);
+    }
+
+    bool generateEnums(
+        std::span<std::string_view const> inputFiles,
+        std::string_view configFile,
+        std::string_view outputPath,
+        GenerateOptions const & options) noexcept
     {
         auto output = resolveOutputPath(outputPath);
 
@@ -444,7 +942,12 @@ namespace enumgen
 
         logger->info("Running enumgen generate");
 
-        auto input = resolveInputFile(inputFile);
+        auto inputs = std::vector<path>();
+        for (auto inputFile : inputFiles)
+        {
+            inputs.emplace_back(resolveInputFile(inputFile));
+        }
+
         auto configPath = resolveConfigFile(configFile);
 
         auto config = tryReadConfig(configPath);
@@ -455,7 +958,7 @@ namespace enumgen
         }
 
 
-        return generateEnums(input, output, *config);
+        return generateEnums(std::span<path const>{ inputs }, output, *config, options);
     }
 
 }  // namespace enumgen
\ No newline at end of file
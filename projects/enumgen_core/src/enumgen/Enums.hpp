@@ -1,23 +1,108 @@
 #pragma once
 
 #include <enumgen/Config.hpp>
+#include <enumgen/utils/Commands.hpp>
 
+#include <cstddef>
 #include <filesystem>
+#include <span>
 #include <string_view>
 
 
 namespace enumgen
 {
 
+    /// <summary>
+    /// Options that control how enums are generated
+    /// </summary>
+    struct GenerateOptions final
+    {
+        /// <summary>
+        /// Number of enums rendered in parallel, 0 uses one job per hardware thread
+        /// </summary>
+        std::size_t jobs = 1ul;
+
+        /// <summary>
+        /// Regenerates every enum, ignoring fingerprints recorded by previous runs
+        /// </summary>
+        bool force = false;
+
+        /// <summary>
+        /// Writes a Make style depfile listing the inputs of the generated files, empty disables the depfile
+        /// </summary>
+        std::string_view depfile;
+
+        /// <summary>
+        /// Writes the files that would be generated to the given file, one per line, without rendering any enums
+        /// </summary>
+        std::string_view listOutputs;
+
+        /// <summary>
+        /// Writes the files generated by the run to the given file, one per line, only rewriting it when the list
+        /// changes. Stale files still named by the previous list are kept for a later run to prune, as a build system
+        /// that has not yet reread the list may still compile them
+        /// </summary>
+        std::string_view outputs;
+
+        /// <summary>
+        /// Reports the stale outputs of enums removed since the previous run without deleting them
+        /// </summary>
+        bool pruneDryRun = false;
+
+        /// <summary>
+        /// Parses specifications incrementally, rendering each enum as soon as it is parsed and then discarding it so
+        /// memory is bounded by the largest enum rather than the whole specification
+        /// </summary>
+        bool stream = false;
+
+        static constexpr auto parameters = parametersFor<GenerateOptions>(
+            Parameter<&GenerateOptions::jobs>("-j", "--jobs", 1ul),
+            Parameter<&GenerateOptions::force>("-f", "--force"),
+            Parameter<&GenerateOptions::depfile>("-d", "--depfile"),
+            Parameter<&GenerateOptions::listOutputs>("-l", "--list-outputs"),
+            Parameter<&GenerateOptions::outputs>("-o", "--outputs"),
+            Parameter<&GenerateOptions::pruneDryRun>("-n", "--prune-dry-run"),
+            Parameter<&GenerateOptions::stream>("-s", "--stream"));
+    };
+
+
     /// <summary>
     /// Generates enum files from the given input file
     /// </summary>
-    bool generateEnums(std::filesystem::path const & inputFile, std::filesystem::path const & outputRoot, Config const & config) noexcept;
+    bool generateEnums(
+        std::filesystem::path const & inputFile,
+        std::filesystem::path const & outputRoot,
+        Config const & config,
+        GenerateOptions const & options = {}) noexcept;
+
+
+    /// <summary>
+    /// Generates enum files from each of the given input files, parsed templates are shared between all inputs
+    /// </summary>
+    bool generateEnums(
+        std::span<std::filesystem::path const> inputFiles,
+        std::filesystem::path const & outputRoot,
+        Config const & config,
+        GenerateOptions const & options = {}) noexcept;
 
 
     /// <summary>
     /// Generates enum files from the given input file
     /// </summary>
-    bool generateEnums(std::string_view inputFile, std::string_view configFile, std::string_view outputPath) noexcept;
+    bool generateEnums(
+        std::string_view inputFile,
+        std::string_view configFile,
+        std::string_view outputPath,
+        GenerateOptions const & options = {}) noexcept;
+
+
+    /// <summary>
+    /// Generates enum files from each of the given input files, parsed templates are shared between all inputs
+    /// </summary>
+    bool generateEnums(
+        std::span<std::string_view const> inputFiles,
+        std::string_view configFile,
+        std::string_view outputPath,
+        GenerateOptions const & options = {}) noexcept;
 
 }  // namespace enumgen
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include <enumgen/Fingerprints.hpp>
+#include <enumgen/utils/Hash.hpp>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+#include <nlohmann/json.hpp>
+
+#include <array>
+#include <charconv>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <stdexcept>
+
+
+using namespace std::filesystem;
+
+
+namespace enumgen
+{
+    namespace
+    {
+
+        constexpr std::string_view enumsField = "enums";
+
+        std::optional<std::uint64_t> parseFingerprint(std::string_view value) noexcept
+        {
+            auto result = std::uint64_t{};
+            auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), result, 16);
+
+            if (error != std::errc{} || end != value.data() + value.size())
+            {
+                return std::nullopt;
+            }
+
+            return result;
+        }
+
+    }  // namespace
+
+
+    FingerprintCache FingerprintCache::load(path const & cacheFile) noexcept
+    {
+        auto cache = FingerprintCache{};
+
+        try
+        {
+            auto stream = std::ifstream(cacheFile, std::ios::in);
+            if (!stream)
+            {
+                return cache;
+            }
+
+            auto json = nlohmann::json::parse(stream);
+            if (!json.contains(enumsField) || !json[enumsField].is_object())
+            {
+                return cache;
+            }
+
+            for (auto const & [key, value] : json[enumsField].items())
+            {
+                if (!value.is_string())
+                {
+                    continue;
+                }
+
+                if (auto fingerprint = parseFingerprint(value.get<std::string_view>()))
+                {
+                    cache.previous.emplace(key, *fingerprint);
+                }
+            }
+        }
+        catch (std::exception const &)
+        {
+            // A corrupt cache only costs a full regeneration
+            cache.previous.clear();
+        }
+
+        return cache;
+    }
+
+    bool FingerprintCache::matches(std::string const & key, std::uint64_t fingerprint) const noexcept
+    {
+        auto it = previous.find(key);
+        return it != previous.end() && it->second == fingerprint;
+    }
+
+    void FingerprintCache::record(std::string key, std::uint64_t fingerprint)
+    {
+        current.insert_or_assign(std::move(key), fingerprint);
+    }
+
+    WriteResult FingerprintCache::save(path const & cacheFile) const
+    {
+        // Sorted so the file content is stable between runs and only rewritten when a fingerprint changes
+        auto sorted = std::map<std::string_view, std::uint64_t>();
+        for (auto const & [key, fingerprint] : current)
+        {
+            sorted.emplace(key, fingerprint);
+        }
+
+        auto json = nlohmann::json{ { enumsField, nlohmann::json::object() } };
+        auto & enums = json[enumsField];
+        for (auto const & [key, fingerprint] : sorted)
+        {
+            enums[std::string(key)] = fmt::format("{:016x}", fingerprint);
+        }
+
+        return writeIfChanged(cacheFile, json.dump(2));
+    }
+
+
+    std::uint64_t fingerprintFile(path const & file)
+    {
+        auto stream = std::ifstream(file, std::ios::in | std::ios::binary);
+        if (!stream)
+        {
+            throw std::runtime_error(fmt::format("Unable to read file '{}'", file));
+        }
+
+        auto hash = fnv1aOffsetBasis;
+        auto buffer = std::array<char, 64ul * 1024ul>{};
+
+        while (stream)
+        {
+            stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            hash = fnv1a(std::string_view(buffer.data(), static_cast<std::size_t>(stream.gcount())), hash);
+        }
+
+        return hash;
+    }
+
+}  // namespace enumgen
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <enumgen/utils/Files.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// Fingerprints of the inputs used to generate each enum, persisted between runs so enums whose inputs are
+    /// unchanged can be skipped
+    /// </summary>
+    class FingerprintCache final
+    {
+    private:
+        std::unordered_map<std::string, std::uint64_t> previous;
+        std::unordered_map<std::string, std::uint64_t> current;
+
+    public:
+        /// <summary>
+        /// Default name of the cache file in the output directory
+        /// </summary>
+        static constexpr std::string_view fileName = "enumgen.cache";
+
+        /// <summary>
+        /// Loads fingerprints recorded by a previous run, a missing or unreadable file results in an empty cache
+        /// </summary>
+        [[nodiscard]] static FingerprintCache load(std::filesystem::path const & cacheFile) noexcept;
+
+        /// <summary>
+        /// Returns true when the previous run recorded the same fingerprint for the key
+        /// </summary>
+        [[nodiscard]] bool matches(std::string const & key, std::uint64_t fingerprint) const noexcept;
+
+        /// <summary>
+        /// Records the fingerprint of a successfully generated enum for the next run
+        /// </summary>
+        void record(std::string key, std::uint64_t fingerprint);
+
+        /// <summary>
+        /// Writes the fingerprints recorded in this run, entries not recorded in this run are dropped
+        /// </summary>
+        WriteResult save(std::filesystem::path const & cacheFile) const;
+    };
+
+
+    /// <summary>
+    /// Computes the fingerprint of the contents of a file
+    /// </summary>
+    [[nodiscard]] std::uint64_t fingerprintFile(std::filesystem::path const & file);
+
+}  // namespace enumgen
\ No newline at end of file
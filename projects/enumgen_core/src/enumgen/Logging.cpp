@@ -1,5 +1,7 @@
 #include <enumgen/Logging.hpp>
 
+#include <spdlog/details/null_mutex.h>
+#include <spdlog/sinks/base_sink.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_sinks.h>
 #include <spdlog/spdlog.h>
@@ -7,6 +9,33 @@
 
 namespace enumgen
 {
+    namespace
+    {
+
+        /// <summary>
+        /// Sink that appends the raw message payloads to a shared vector
+        /// </summary>
+        class BufferSink final : public spdlog::sinks::base_sink<spdlog::details::null_mutex>
+        {
+        private:
+            std::shared_ptr<std::vector<LogBuffer::message_type>> messages;
+
+        public:
+            explicit BufferSink(std::shared_ptr<std::vector<LogBuffer::message_type>> messages) noexcept
+              : messages(std::move(messages))
+            { }
+
+        protected:
+            void sink_it_(spdlog::details::log_msg const & message) override
+            {
+                messages->emplace_back(message.level, std::string(message.payload.data(), message.payload.size()));
+            }
+
+            void flush_() override
+            { }
+        };
+
+    }  // namespace
 
     void initLogging(std::filesystem::path const & outputDirectory)
     {
@@ -37,4 +66,26 @@ namespace enumgen
         spdlog::register_logger(std::move(logger));
     }
 
+    LogBuffer::LogBuffer()
+      : messages(std::make_shared<std::vector<message_type>>())
+      , bufferLogger(std::make_shared<spdlog::logger>("logger", std::make_shared<BufferSink>(messages)))
+    {
+        bufferLogger->set_level(spdlog::level::trace);
+    }
+
+    std::shared_ptr<spdlog::logger> const & LogBuffer::logger() const noexcept
+    {
+        return bufferLogger;
+    }
+
+    void LogBuffer::replay(spdlog::logger & target)
+    {
+        for (auto const & [level, message] : *messages)
+        {
+            target.log(level, spdlog::string_view_t(message));
+        }
+
+        messages->clear();
+    }
+
 }  // namespace enumgen
\ No newline at end of file
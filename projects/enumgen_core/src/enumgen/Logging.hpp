@@ -1,6 +1,12 @@
 #pragma once
 
+#include <spdlog/logger.h>
+
 #include <filesystem>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 
 namespace enumgen
@@ -8,4 +14,32 @@ namespace enumgen
 
     void initLogging(std::filesystem::path const & outputDirectory);
 
+
+    /// <summary>
+    /// Logger that holds messages in memory until they are replayed into another logger, used to keep output from
+    /// concurrent work in a deterministic order
+    /// </summary>
+    class LogBuffer final
+    {
+    public:
+        using message_type = std::pair<spdlog::level::level_enum, std::string>;
+
+    private:
+        std::shared_ptr<std::vector<message_type>> messages;
+        std::shared_ptr<spdlog::logger> bufferLogger;
+
+    public:
+        LogBuffer();
+
+        /// <summary>
+        /// Returns the logger that writes into the buffer
+        /// </summary>
+        [[nodiscard]] std::shared_ptr<spdlog::logger> const & logger() const noexcept;
+
+        /// <summary>
+        /// Writes all buffered messages into the target logger and clears the buffer
+        /// </summary>
+        void replay(spdlog::logger & target);
+    };
+
 }  // namespace enumgen
\ No newline at end of file
@@ -0,0 +1,290 @@
+#include <enumgen/Specification.hpp>
+
+#include <fmt/format.h>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+using namespace nlohmann;
+using namespace std::string_view_literals;
+
+
+namespace enumgen
+{
+    namespace
+    {
+
+        static constexpr std::string_view headerRootField = "headerRoot"sv;
+        static constexpr std::string_view codeRootField = "codeRoot"sv;
+        static constexpr std::string_view enumsField = "enums"sv;
+
+        /// <summary>
+        /// SAX handler that builds a DOM for one root value or 'enums' element at a time
+        /// </summary>
+        class SpecificationHandler final : public json_sax<json>
+        {
+        private:
+            EnumHandler const & onEnum;
+
+            json rootFields = json::object();
+            std::string rootKey;
+            std::string objectKey;
+            bool inEnums = false;
+            bool enumsStarted = false;
+
+            // Number of open containers, the root object is depth 1 and the 'enums' array is depth 2
+            std::size_t depth = 0ul;
+
+            json current;
+            std::vector<json *> stack;
+            std::string error;
+
+        public:
+            explicit SpecificationHandler(EnumHandler const & onEnum) : onEnum(onEnum)
+            { }
+
+            [[nodiscard]] json takeRootFields() noexcept
+            {
+                return std::move(rootFields);
+            }
+
+            [[nodiscard]] std::string const & errorMessage() const noexcept
+            {
+                return error;
+            }
+
+            [[nodiscard]] bool sawEnums() const noexcept
+            {
+                return enumsStarted;
+            }
+
+            bool null() override
+            {
+                return addScalar(json(nullptr));
+            }
+
+            bool boolean(bool value) override
+            {
+                return addScalar(json(value));
+            }
+
+            bool number_integer(number_integer_t value) override
+            {
+                return addScalar(json(value));
+            }
+
+            bool number_unsigned(number_unsigned_t value) override
+            {
+                return addScalar(json(value));
+            }
+
+            bool number_float(number_float_t value, string_t const &) override
+            {
+                return addScalar(json(value));
+            }
+
+            bool string(string_t & value) override
+            {
+                return addScalar(json(std::move(value)));
+            }
+
+            bool binary(binary_t & value) override
+            {
+                return addScalar(json::binary(std::move(value)));
+            }
+
+            bool start_object(std::size_t) override
+            {
+                return startContainer(json::object());
+            }
+
+            bool key(string_t & value) override
+            {
+                if (depth != 1ul)
+                {
+                    objectKey = std::move(value);
+                    return true;
+                }
+
+                // Enums are resolved as they are parsed so output roots declared after them would be missed
+                if (enumsStarted && (value == headerRootField || value == codeRootField))
+                {
+                    return fail(fmt::format("'{}' must precede '{}' when streaming", value, enumsField));
+                }
+
+                rootKey = std::move(value);
+                return true;
+            }
+
+            bool end_object() override
+            {
+                return endContainer();
+            }
+
+            bool start_array(std::size_t) override
+            {
+                return startContainer(json::array());
+            }
+
+            bool end_array() override
+            {
+                return endContainer();
+            }
+
+            bool parse_error(std::size_t, std::string const &, detail::exception const & ex) override
+            {
+                return fail(ex.what());
+            }
+
+        private:
+            bool fail(std::string message)
+            {
+                error = std::move(message);
+                return false;
+            }
+
+            bool startContainer(json container)
+            {
+                if (depth == 0ul)
+                {
+                    if (!container.is_object())
+                    {
+                        return fail("Specification root should be an object");
+                    }
+
+                    ++depth;
+                    return true;
+                }
+
+                if (depth == 1ul && rootKey == enumsField)
+                {
+                    if (!container.is_array())
+                    {
+                        return fail(fmt::format("'{}' should contain an array of enum descriptions", enumsField));
+                    }
+
+                    inEnums = true;
+                    enumsStarted = true;
+                    ++depth;
+                    return true;
+                }
+
+                ++depth;
+                addValue(std::move(container), true);
+                return true;
+            }
+
+            bool endContainer()
+            {
+                --depth;
+
+                if (depth == 0ul)
+                {
+                    return true;
+                }
+
+                if (inEnums && depth == 1ul)
+                {
+                    inEnums = false;
+                    return true;
+                }
+
+                stack.pop_back();
+                if (stack.empty())
+                {
+                    complete();
+                }
+
+                return true;
+            }
+
+            bool addScalar(json value)
+            {
+                if (depth == 0ul)
+                {
+                    return fail("Specification root should be an object");
+                }
+
+                if (depth == 1ul && rootKey == enumsField)
+                {
+                    return fail(fmt::format("'{}' should contain an array of enum descriptions", enumsField));
+                }
+
+                addValue(std::move(value), false);
+                return true;
+            }
+
+            void addValue(json value, bool isContainer)
+            {
+                if (stack.empty())
+                {
+                    current = std::move(value);
+                    if (isContainer)
+                    {
+                        stack.emplace_back(&current);
+                    }
+                    else
+                    {
+                        complete();
+                    }
+
+                    return;
+                }
+
+                auto & parent = *stack.back();
+                auto * added = static_cast<json *>(nullptr);
+
+                if (parent.is_array())
+                {
+                    parent.emplace_back(std::move(value));
+                    added = &parent.back();
+                }
+                else
+                {
+                    added = &(parent[objectKey] = std::move(value));
+                }
+
+                if (isContainer)
+                {
+                    stack.emplace_back(added);
+                }
+            }
+
+            void complete()
+            {
+                if (inEnums)
+                {
+                    onEnum(rootFields, std::exchange(current, json()));
+                }
+                else
+                {
+                    rootFields[rootKey] = std::exchange(current, json());
+                }
+            }
+        };
+
+    }  // namespace
+
+
+    json streamSpecification(std::string_view input, EnumHandler const & onEnum)
+    {
+        auto handler = SpecificationHandler(onEnum);
+
+        if (!json::sax_parse(input.begin(), input.end(), &handler))
+        {
+            throw std::runtime_error(handler.errorMessage());
+        }
+
+        if (!handler.sawEnums())
+        {
+            throw std::runtime_error(fmt::format("'{}' root node is missing", enumsField));
+        }
+
+        return handler.takeRootFields();
+    }
+
+}  // namespace enumgen
\ No newline at end of file
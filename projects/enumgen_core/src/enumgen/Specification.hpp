@@ -0,0 +1,27 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <functional>
+#include <string_view>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// Receives each enum description as soon as it has been parsed along with the root fields that preceded it,
+    /// ownership of the description is passed to the handler
+    /// </summary>
+    using EnumHandler = std::function<void(nlohmann::json const & rootFields, nlohmann::json && description)>;
+
+
+    /// <summary>
+    /// Parses a specification with the SAX interface so only a single enum description is held in memory at a time.
+    /// Each element of 'enums' is passed to the handler once it is complete and the other root fields are returned.
+    /// Root fields that affect output paths must precede 'enums'. Throws std::runtime_error if the input is not a
+    /// valid specification document
+    /// </summary>
+    nlohmann::json streamSpecification(std::string_view input, EnumHandler const & onEnum);
+
+}  // namespace enumgen
\ No newline at end of file
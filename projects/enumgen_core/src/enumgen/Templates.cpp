@@ -0,0 +1,80 @@
+#include <enumgen/Templates.hpp>
+
+
+using namespace std::filesystem;
+
+
+namespace enumgen
+{
+
+    TemplateStats & TemplateStats::operator+=(TemplateStats const & other) noexcept
+    {
+        parseCount += other.parseCount;
+        renderCount += other.renderCount;
+        return *this;
+    }
+
+
+    TemplateCache::TemplateCache(path const & templatesDirectory)
+      : env(templatesDirectory.empty() ? std::string() : (templatesDirectory / "").string())
+    {
+        env.set_trim_blocks(true);
+    }
+
+    inja::Template const & TemplateCache::get(path const & templateFile)
+    {
+        auto lastWriteTime = last_write_time(templateFile);
+
+        auto [it, inserted] = entries.try_emplace(templateFile.string());
+        auto & entry = it->second;
+
+        if (inserted || entry.lastWriteTime != lastWriteTime)
+        {
+            try
+            {
+                auto file = MappedFile(templateFile);
+                entry.parsed = env.parse(file.view());
+                entry.lastWriteTime = lastWriteTime;
+                ++counters.parseCount;
+            }
+            catch (...)
+            {
+                entries.erase(it);
+                throw;
+            }
+        }
+
+        return entry.parsed;
+    }
+
+    void TemplateCache::include(std::string const & name, path const & templateFile)
+    {
+        auto parseCount = counters.parseCount;
+        auto const & parsed = get(templateFile);
+
+        if (counters.parseCount != parseCount || !includes.contains(name))
+        {
+            env.include_template(name, parsed);
+            includes.insert(name);
+        }
+    }
+
+    std::string TemplateCache::render(path const & templateFile, nlohmann::json const & data)
+    {
+        auto const & parsed = get(templateFile);
+        ++counters.renderCount;
+        return env.render(parsed, data);
+    }
+
+    WriteResult TemplateCache::write(
+        path const & templateFile, nlohmann::json const & data, path const & outputFile)
+    {
+        return writeIfChanged(outputFile, render(templateFile, data));
+    }
+
+    TemplateStats const & TemplateCache::stats() const noexcept
+    {
+        return counters;
+    }
+
+}  // namespace enumgen
\ No newline at end of file
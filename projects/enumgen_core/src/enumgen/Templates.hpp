@@ -0,0 +1,87 @@
+#pragma once
+
+#include <enumgen/utils/Files.hpp>
+
+#include <inja/inja.hpp>
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// Counts of template parses and renders
+    /// </summary>
+    struct TemplateStats final
+    {
+        std::size_t parseCount = 0ul;
+        std::size_t renderCount = 0ul;
+
+        TemplateStats & operator+=(TemplateStats const & other) noexcept;
+    };
+
+
+    /// <summary>
+    /// Templating environment that parses each template file once and reuses the parsed template for every render
+    /// until the file is modified. Not thread safe, each worker should own a cache
+    /// </summary>
+    class TemplateCache final
+    {
+    private:
+        struct Entry final
+        {
+            std::filesystem::file_time_type lastWriteTime;
+            inja::Template parsed;
+        };
+
+        inja::Environment env;
+        std::unordered_map<std::string, Entry> entries;
+        std::unordered_set<std::string> includes;
+        TemplateStats counters;
+
+    public:
+        /// <summary>
+        /// Creates a cache whose templates resolve inja includes relative to the templates directory
+        /// </summary>
+        explicit TemplateCache(std::filesystem::path const & templatesDirectory = {});
+
+        /// <summary>
+        /// Returns the parsed template for the file, parsing it when it is not cached or has changed on disk. The file is
+        /// parsed straight from a memory mapped view
+        /// </summary>
+        [[nodiscard]] inja::Template const & get(std::filesystem::path const & templateFile);
+
+        /// <summary>
+        /// Registers the template file for inja includes under the given name, taking precedence over looking the name
+        /// up in the templates directory. Registered again only when the file has changed on disk, templates that
+        /// include it render the latest version without being parsed again
+        /// </summary>
+        void include(std::string const & name, std::filesystem::path const & templateFile);
+
+        /// <summary>
+        /// Renders the template file with the given data
+        /// </summary>
+        [[nodiscard]] std::string render(std::filesystem::path const & templateFile, nlohmann::json const & data);
+
+        /// <summary>
+        /// Renders the template file with the given data into memory and writes it to the output file only when the
+        /// content differs from the existing file
+        /// </summary>
+        WriteResult write(
+            std::filesystem::path const & templateFile,
+            nlohmann::json const & data,
+            std::filesystem::path const & outputFile);
+
+        /// <summary>
+        /// Returns the number of parses and renders performed by this cache
+        /// </summary>
+        [[nodiscard]] TemplateStats const & stats() const noexcept;
+    };
+
+}  // namespace enumgen
\ No newline at end of file
@@ -0,0 +1,608 @@
+#include <enumgen/Validation.hpp>
+#include <enumgen/analysis/Analysis.hpp>
+#include <enumgen/analysis/ParseStrategy.hpp>
+#include <enumgen/analysis/UnderlyingType.hpp>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+
+using namespace fmt::literals;
+using namespace nlohmann;
+using namespace std::string_view_literals;
+
+
+namespace enumgen
+{
+    namespace
+    {
+
+        static constexpr std::string_view enumsField = "enums"sv;
+
+        static constexpr std::string_view nameField = "name"sv;
+        static constexpr std::string_view descriptionField = "description"sv;
+        static constexpr std::string_view headerPathField = "headerPath"sv;
+        static constexpr std::string_view codePathField = "codePath"sv;
+        static constexpr std::string_view includePathField = "includePath"sv;
+        static constexpr std::string_view namespaceField = "namespace"sv;
+        static constexpr std::string_view underlyingTypeField = "underlyingType"sv;
+        static constexpr std::string_view defaultField = "default"sv;
+        static constexpr std::string_view parseStrategyField = "parseStrategy"sv;
+        static constexpr std::string_view caseInsensitiveField = "caseInsensitive"sv;
+        static constexpr std::string_view flagsField = "flags"sv;
+
+        static constexpr std::string_view itemsArray = "items"sv;
+        static constexpr std::string_view itemNameField = "name"sv;
+        static constexpr std::string_view itemValueField = "value"sv;
+        static constexpr std::string_view itemStringField = "string"sv;
+        static constexpr std::string_view itemAltsArray = "alts"sv;
+
+        enum class FieldType : std::uint8_t
+        {
+            String,
+            Integer,
+            Boolean,
+            Array,
+            StringArray
+        };
+
+        /// <summary>
+        /// Describes the checks for a single field, messages are format strings taking the {name} of the enum or
+        /// item and the {field} name, and are only formatted when a check fails. A string field with allowed values
+        /// must hold one of them
+        /// </summary>
+        struct FieldRule final
+        {
+            std::string_view field;
+            FieldType type;
+            bool required;
+            std::string_view missingMessage;
+            std::string_view typeMessage;
+            std::string_view emptyMessage = {};
+            std::span<std::string_view const> allowedValues = {};
+            std::string_view valueMessage = {};
+        };
+
+        static constexpr auto enumsRule = FieldRule{ enumsField,
+                                                     FieldType::Array,
+                                                     true,
+                                                     "'{field}' root node is missing",
+                                                     "'{field}' should contain an array of enum descriptions" };
+
+        static constexpr auto enumNameRule = FieldRule{ nameField,
+                                                        FieldType::String,
+                                                        true,
+                                                        "Enum description is missing required '{field}' field",
+                                                        "Enum description has non-string '{field}' field",
+                                                        "Enum description has empty '{field}' field" };
+
+        constexpr FieldRule requiredEnumString(std::string_view field) noexcept
+        {
+            return FieldRule{ field,
+                              FieldType::String,
+                              true,
+                              "Enum '{name}' is missing required '{field}' field",
+                              "Enum '{name}::{field}' should hold a string",
+                              "Enum '{name}::{field}' cannot be empty" };
+        }
+
+        constexpr FieldRule optionalEnumString(std::string_view field) noexcept
+        {
+            return FieldRule{ field,
+                              FieldType::String,
+                              false,
+                              {},
+                              "Enum '{name}::{field}' should hold a string",
+                              "Enum '{name}::{field}' cannot be empty" };
+        }
+
+        static constexpr auto parseStrategyRule = FieldRule{ parseStrategyField,
+                                                             FieldType::String,
+                                                             false,
+                                                             {},
+                                                             "Enum '{name}::{field}' should hold a string",
+                                                             "Enum '{name}::{field}' cannot be empty",
+                                                             parseStrategyNames,
+                                                             "Enum '{name}::{field}' should be one of {values}" };
+
+        constexpr FieldRule optionalEnumBoolean(std::string_view field) noexcept
+        {
+            return FieldRule{ field, FieldType::Boolean, false, {}, "Enum '{name}::{field}' should hold a boolean" };
+        }
+
+        static constexpr auto enumRules = std::array{
+            requiredEnumString(headerPathField),
+            requiredEnumString(codePathField),
+            requiredEnumString(includePathField),
+            requiredEnumString(namespaceField),
+            optionalEnumString(descriptionField),
+            optionalEnumString(underlyingTypeField),
+            optionalEnumString(defaultField),
+            parseStrategyRule,
+            optionalEnumBoolean(caseInsensitiveField),
+            optionalEnumBoolean(flagsField),
+        };
+
+        static constexpr auto itemsRule = FieldRule{ itemsArray,
+                                                     FieldType::Array,
+                                                     true,
+                                                     "Enum '{name}' is missing required '{field}' field",
+                                                     "Enum '{name}::{field}' is not an array" };
+
+        static constexpr auto itemNameRule = FieldRule{ itemNameField,
+                                                        FieldType::String,
+                                                        true,
+                                                        "Enum '{name}' has item with missing '{field}' field",
+                                                        "Enum '{name}' item has non-string '{field}' field",
+                                                        "Enum '{name}' item has empty string '{field}' field" };
+
+        static constexpr auto itemRules = std::array{
+            FieldRule{ itemStringField,
+                       FieldType::String,
+                       true,
+                       "Enum item '{name}' is missing '{field}' field",
+                       "Enum item '{name}::{field}' has non-string value",
+                       "Enum item '{name}::{field}' has empty string value" },
+            FieldRule{ itemValueField, FieldType::Integer, false, {}, "Enum item '{name}::{field}' has non-int value" },
+            FieldRule{ itemAltsArray,
+                       FieldType::StringArray,
+                       false,
+                       {},
+                       "Enum item '{name}::{field}' has non-array value",
+                       "Enum item '{name}::{field}' has non-string values" },
+        };
+
+        /// <summary>
+        /// Describes a check on the meaning of fields that already hold the right type, the message is a format string
+        /// taking the {name} of the enum or item and the {field} name, and is only formatted when the check fails
+        /// </summary>
+        struct SemanticRule final
+        {
+            std::string_view field;
+            std::string_view message;
+        };
+
+        /// <summary>
+        /// Checks for flags enums
+        /// </summary>
+        static constexpr auto flagValueRule
+            = SemanticRule{ itemValueField, "Enum item '{name}::{field}' should be a non-negative flag" };
+
+        static constexpr auto flagOverflowRule
+            = SemanticRule{ itemValueField, "Enum item '{name}' has no bit left for an implicit flag" };
+
+        static constexpr auto flagStringRule
+            = SemanticRule{ itemStringField, "Enum item '{name}' strings cannot contain the separator '|'" };
+
+        /// <summary>
+        /// Semantic checks across the items of an enum, only made once every field is valid
+        /// </summary>
+        static constexpr auto duplicateNameRule
+            = SemanticRule{ itemNameField, "Enum item '{name}' has the same name as an earlier item" };
+
+        static constexpr auto duplicateStringRule
+            = SemanticRule{ itemStringField, "Enum item '{name}::{field}' already parses to another item" };
+
+        static constexpr auto duplicateAltRule = SemanticRule{
+            itemAltsArray, "Enum item '{name}::{field}' holds a string that already parses to another item"
+        };
+
+        static constexpr auto valueRangeRule
+            = SemanticRule{ itemValueField, "Enum item '{name}::{field}' does not fit in the underlying type" };
+
+        static constexpr auto unresolvedValuesRule
+            = SemanticRule{ itemsArray, "Enum '{name}' has values that do not fit in any underlying type" };
+
+        static constexpr auto maxFlagValue = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+        static constexpr auto highestFlag = std::bit_floor(maxFlagValue);
+
+        /// <summary>
+        /// Enum or item a field belongs to, only joined into a single name when an error is reported
+        /// </summary>
+        struct Subject final
+        {
+            std::string_view enumName = {};
+            std::string_view itemName = {};
+
+            [[nodiscard]] std::string name() const
+            {
+                return itemName.empty() ? std::string(enumName) : fmt::format("{}::{}", enumName, itemName);
+            }
+        };
+
+        void report(
+            std::string_view message, Subject const & subject, FieldRule const & rule, std::vector<std::string> & errors)
+        {
+            errors.emplace_back(fmt::format(
+                fmt::runtime(message),
+                "name"_a = subject.name(),
+                "field"_a = rule.field,
+                "values"_a = fmt::join(rule.allowedValues, ", ")));
+        }
+
+        void report(Subject const & subject, SemanticRule const & rule, std::vector<std::string> & errors)
+        {
+            errors.emplace_back(
+                fmt::format(fmt::runtime(rule.message), "name"_a = subject.name(), "field"_a = rule.field));
+        }
+
+        bool allStrings(json const & node) noexcept
+        {
+            for (auto const & item : node)
+            {
+                if (!item.is_string())
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool isAllowed(FieldRule const & rule, std::string_view value) noexcept
+        {
+            return std::find(rule.allowedValues.begin(), rule.allowedValues.end(), value) != rule.allowedValues.end();
+        }
+
+        /// <summary>
+        /// Checks a single field against its rule with one lookup, returns the value when it is present and valid
+        /// </summary>
+        json const * checkField(
+            json const & node, FieldRule const & rule, Subject const & subject, std::vector<std::string> & errors)
+        {
+            auto it = node.find(rule.field);
+            if (it == node.end())
+            {
+                if (rule.required)
+                {
+                    report(rule.missingMessage, subject, rule, errors);
+                }
+
+                return nullptr;
+            }
+
+            auto const & value = *it;
+            switch (rule.type)
+            {
+            case FieldType::String:
+                if (!value.is_string())
+                {
+                    report(rule.typeMessage, subject, rule, errors);
+                    return nullptr;
+                }
+
+                if (value.get_ref<std::string const &>().empty())
+                {
+                    report(rule.emptyMessage, subject, rule, errors);
+                    return nullptr;
+                }
+
+                if (!rule.allowedValues.empty() && !isAllowed(rule, value.get_ref<std::string const &>()))
+                {
+                    report(rule.valueMessage, subject, rule, errors);
+                    return nullptr;
+                }
+
+                break;
+
+            case FieldType::Integer:
+                if (!value.is_number_integer())
+                {
+                    report(rule.typeMessage, subject, rule, errors);
+                    return nullptr;
+                }
+
+                break;
+
+            case FieldType::Boolean:
+                if (!value.is_boolean())
+                {
+                    report(rule.typeMessage, subject, rule, errors);
+                    return nullptr;
+                }
+
+                break;
+
+            case FieldType::Array:
+                if (!value.is_array())
+                {
+                    report(rule.typeMessage, subject, rule, errors);
+                    return nullptr;
+                }
+
+                break;
+
+            case FieldType::StringArray:
+                if (!value.is_array())
+                {
+                    report(rule.typeMessage, subject, rule, errors);
+                    return nullptr;
+                }
+
+                if (!allStrings(value))
+                {
+                    report(rule.emptyMessage, subject, rule, errors);
+                    return nullptr;
+                }
+
+                break;
+            }
+
+            return &value;
+        }
+
+        void validateItem(std::string_view enumName, json const & node, std::vector<std::string> & errors)
+        {
+            auto const * name = checkField(node, itemNameRule, Subject{ enumName }, errors);
+            if (!name)
+            {
+                return;
+            }
+
+            auto subject = Subject{ enumName, name->get_ref<std::string const &>() };
+            for (auto const & rule : itemRules)
+            {
+                checkField(node, rule, subject, errors);
+            }
+        }
+
+        bool isFlags(json const & node) noexcept
+        {
+            auto field = node.find(flagsField);
+            return field != node.end() && field->is_boolean() && field->get<bool>();
+        }
+
+        std::optional<std::uint64_t> followingFlag(std::uint64_t flag) noexcept
+        {
+            return flag == highestFlag ? std::nullopt : std::optional(flag << 1u);
+        }
+
+        bool containsSeparator(json const & string) noexcept
+        {
+            return string.is_string() && string.get_ref<std::string const &>().find('|') != std::string::npos;
+        }
+
+        /// <summary>
+        /// Flags are bit masks, values cannot be negative and implicit values take the bit above the highest bit of
+        /// the previous value, which must fit in a 64 bit signed value. Strings cannot contain the separator used to
+        /// parse several flags
+        /// </summary>
+        void validateFlags(Subject const & subject, json const & items, std::vector<std::string> & errors)
+        {
+            auto next = std::optional<std::uint64_t>(1ul);
+
+            for (auto const & item : items)
+            {
+                auto name = item.find(itemNameField);
+                if (name == item.end() || !name->is_string())
+                {
+                    continue;
+                }
+
+                auto itemSubject = Subject{ subject.enumName, name->get_ref<std::string const &>() };
+
+                auto value = item.find(itemValueField);
+                if (value != item.end() && value->is_number_integer())
+                {
+                    if (value->is_number_unsigned() ? value->get<std::uint64_t>() > maxFlagValue
+                                                     : value->get<std::int64_t>() < 0)
+                    {
+                        report(itemSubject, flagValueRule, errors);
+                    }
+                    else
+                    {
+                        auto highest = std::bit_floor(value->get<std::uint64_t>());
+                        next = highest == 0ul ? std::optional<std::uint64_t>(1ul) : followingFlag(highest);
+                    }
+                }
+                else if (value == item.end())
+                {
+                    if (!next)
+                    {
+                        report(itemSubject, flagOverflowRule, errors);
+                    }
+                    else
+                    {
+                        next = followingFlag(*next);
+                    }
+                }
+
+                auto string = item.find(itemStringField);
+                auto alts = item.find(itemAltsArray);
+
+                auto separated = (string != item.end() && containsSeparator(*string))
+                                 || (alts != item.end() && alts->is_array()
+                                     && std::any_of(alts->begin(), alts->end(), containsSeparator));
+
+                if (separated)
+                {
+                    report(itemSubject, flagStringRule, errors);
+                }
+            }
+        }
+
+        /// <summary>
+        /// String an item parses from as compared when parsing, folded to lower case for a case insensitive enum
+        /// </summary>
+        std::string parseKey(json const & string, bool caseInsensitive)
+        {
+            auto key = string.get<std::string>();
+            if (caseInsensitive)
+            {
+                for (auto & c : key)
+                {
+                    c = (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+                }
+            }
+
+            return key;
+        }
+
+        /// <summary>
+        /// Reports items repeating the name of an earlier item, and strings or alts that parse to an earlier item
+        /// which would otherwise silently win. One pass over the items with a lookup per name and string
+        /// </summary>
+        void validateDuplicates(Subject const & subject, json const & node, std::vector<std::string> & errors)
+        {
+            auto const & items = node[itemsArray];
+            auto caseInsensitive = node.contains(caseInsensitiveField) && node[caseInsensitiveField].get<bool>();
+
+            auto names = std::unordered_set<std::string_view>();
+            auto keys = std::unordered_map<std::string, std::size_t>();
+            names.reserve(items.size());
+            keys.reserve(items.size());
+
+            for (auto index = 0ul; index < items.size(); ++index)
+            {
+                auto const & item = items[index];
+                auto itemSubject = Subject{ subject.enumName, item[itemNameField].get_ref<std::string const &>() };
+
+                if (!names.insert(itemSubject.itemName).second)
+                {
+                    report(itemSubject, duplicateNameRule, errors);
+                }
+
+                // Repeating a string within the same item is redundant but still parses to that item
+                auto [string, inserted] = keys.try_emplace(parseKey(item[itemStringField], caseInsensitive), index);
+                if (!inserted && string->second != index)
+                {
+                    report(itemSubject, duplicateStringRule, errors);
+                }
+
+                auto alts = item.find(itemAltsArray);
+                if (alts == item.end())
+                {
+                    continue;
+                }
+
+                for (auto const & alt : *alts)
+                {
+                    auto [existing, added] = keys.try_emplace(parseKey(alt, caseInsensitive), index);
+                    if (!added && existing->second != index)
+                    {
+                        report(itemSubject, duplicateAltRule, errors);
+                        break;
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Reports item values, explicit or following the previous item, that do not fit in the underlying type.
+        /// Without an underlying type the values only need to fit in one, enumgen picks the narrowest. Underlying
+        /// types enumgen does not know are left to the compiler
+        /// </summary>
+        void validateValueRanges(Subject const & subject, json const & node, std::vector<std::string> & errors)
+        {
+            auto underlyingType = std::optional<UnderlyingType>();
+            if (auto field = node.find(underlyingTypeField); field != node.end())
+            {
+                underlyingType = findUnderlyingType(field->get_ref<std::string const &>());
+                if (!underlyingType)
+                {
+                    return;
+                }
+            }
+
+            auto values = resolveItemValues(node);
+            if (!values)
+            {
+                // Only unsigned 64 bit types hold values past the signed 64 bit range
+                if (!underlyingType || underlyingType->max != std::numeric_limits<std::uint64_t>::max())
+                {
+                    report(subject, unresolvedValuesRule, errors);
+                }
+
+                return;
+            }
+
+            if (!underlyingType)
+            {
+                return;
+            }
+
+            auto const & items = node[itemsArray];
+            for (auto index = 0ul; index < values->size(); ++index)
+            {
+                if (!underlyingType->holds((*values)[index]))
+                {
+                    auto const & name = items[index][itemNameField].get_ref<std::string const &>();
+                    report(Subject{ subject.enumName, name }, valueRangeRule, errors);
+                }
+            }
+        }
+
+    }  // namespace
+
+
+    void validateEnum(json const & node, std::vector<std::string> & errors) noexcept
+    {
+        auto errorCount = errors.size();
+
+        auto const * name = checkField(node, enumNameRule, Subject{}, errors);
+        if (!name)
+        {
+            return;
+        }
+
+        auto subject = Subject{ name->get_ref<std::string const &>() };
+        for (auto const & rule : enumRules)
+        {
+            checkField(node, rule, subject, errors);
+        }
+
+        auto const * items = checkField(node, itemsRule, subject, errors);
+        if (!items)
+        {
+            return;
+        }
+
+        for (auto const & item : *items)
+        {
+            validateItem(subject.enumName, item, errors);
+        }
+
+        if (isFlags(node))
+        {
+            validateFlags(subject, *items, errors);
+        }
+
+        // The semantic checks read fields without checking them again
+        if (errors.size() == errorCount)
+        {
+            validateDuplicates(subject, node, errors);
+            validateValueRanges(subject, node, errors);
+        }
+    }
+
+    std::vector<std::string> validateSpecification(json const & node) noexcept
+    {
+        auto errors = std::vector<std::string>();
+
+        auto const * enums = checkField(node, enumsRule, Subject{}, errors);
+        if (!enums)
+        {
+            return errors;
+        }
+
+        for (auto const & description : *enums)
+        {
+            validateEnum(description, errors);
+        }
+
+        return errors;
+    }
+
+}  // namespace enumgen
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <string>
+#include <vector>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// Validates a single enum description, appending a message to errors for each problem found. Once every field is
+    /// valid the items are checked against each other for repeated names, strings that parse to more than one item
+    /// and values that do not fit in the underlying type
+    /// </summary>
+    void validateEnum(nlohmann::json const & node, std::vector<std::string> & errors) noexcept;
+
+    /// <summary>
+    /// Validates an enum specification, returns a message for each problem found or an empty list when the
+    /// specification is valid. Only the checks across the items of each enum allocate for a valid specification
+    /// </summary>
+    [[nodiscard]] std::vector<std::string> validateSpecification(nlohmann::json const & node) noexcept;
+
+}  // namespace enumgen
\ No newline at end of file
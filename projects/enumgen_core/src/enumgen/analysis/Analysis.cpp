@@ -0,0 +1,776 @@
+#include <enumgen/analysis/Analysis.hpp>
+#include <enumgen/analysis/PerfectHash.hpp>
+#include <enumgen/analysis/SwitchTree.hpp>
+#include <enumgen/analysis/UnderlyingType.hpp>
+#include <enumgen/analysis/ValueTable.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+
+using namespace nlohmann;
+using namespace std::string_view_literals;
+
+
+namespace enumgen
+{
+    namespace
+    {
+
+        static constexpr std::string_view parseStrategyField = "parseStrategy"sv;
+        static constexpr std::string_view caseInsensitiveField = "caseInsensitive"sv;
+        static constexpr std::string_view flagsField = "flags"sv;
+        static constexpr std::string_view itemsArray = "items"sv;
+        static constexpr std::string_view itemNameField = "name"sv;
+        static constexpr std::string_view itemStringField = "string"sv;
+        static constexpr std::string_view itemAltsArray = "alts"sv;
+        static constexpr std::string_view itemValueField = "value"sv;
+        static constexpr std::string_view underlyingTypeField = "underlyingType"sv;
+
+        static constexpr std::string_view parseKeysArray = "parseKeys"sv;
+        static constexpr std::string_view perfectHashField = "perfectHash"sv;
+        static constexpr std::string_view switchTreeArray = "switchTree"sv;
+        static constexpr std::string_view batchPrefixesArray = "batchPrefixes"sv;
+        static constexpr std::string_view keyStringField = "string"sv;
+        static constexpr std::string_view keyLiteralField = "literal"sv;
+        static constexpr std::string_view keyItemField = "item"sv;
+        static constexpr std::string_view bucketCountField = "bucketCount"sv;
+        static constexpr std::string_view tableSizeField = "tableSize"sv;
+        static constexpr std::string_view seedsArray = "seeds"sv;
+        static constexpr std::string_view slotsArray = "slots"sv;
+        static constexpr std::string_view nodeKindField = "kind"sv;
+        static constexpr std::string_view nodeDepthField = "depth"sv;
+        static constexpr std::string_view nodeIndentField = "indent"sv;
+        static constexpr std::string_view nodePositionField = "position"sv;
+        static constexpr std::string_view nodeLabelField = "label"sv;
+        static constexpr std::string_view valuesField = "values"sv;
+        static constexpr std::string_view layoutField = "layout"sv;
+        static constexpr std::string_view offsetItemField = "offsetItem"sv;
+        static constexpr std::string_view maxItemField = "maxItem"sv;
+        static constexpr std::string_view gaplessField = "gapless"sv;
+        static constexpr std::string_view tableArray = "table"sv;
+        static constexpr std::string_view entryValueField = "value"sv;
+        static constexpr std::string_view ordinalsField = "ordinals"sv;
+        static constexpr std::string_view contiguousField = "contiguous"sv;
+        static constexpr std::string_view ordinalField = "ordinal"sv;
+        static constexpr std::string_view maskField = "mask"sv;
+        static constexpr std::string_view namedBitsField = "namedBits"sv;
+        static constexpr std::string_view bitsArray = "bits"sv;
+        static constexpr std::string_view bitField = "bit"sv;
+        static constexpr std::string_view maxStringSizeField = "maxStringSize"sv;
+        static constexpr std::string_view encodingField = "encoding"sv;
+        static constexpr std::string_view encodingModeField = "mode"sv;
+        static constexpr std::string_view codeBitsField = "codeBits"sv;
+        static constexpr std::string_view codeTypeField = "codeType"sv;
+        static constexpr std::string_view codeCountField = "codeCount"sv;
+        static constexpr std::string_view varintSizeField = "varintSize"sv;
+        static constexpr std::string_view bitmapArray = "bitmap"sv;
+        static constexpr std::string_view sortedArray = "sorted"sv;
+        static constexpr std::string_view validityField = "validity"sv;
+        static constexpr std::string_view bitCountField = "bitCount"sv;
+
+        static constexpr auto unknownName = "Unknown"sv;
+        static constexpr auto flagSeparator = "|"sv;
+
+        static constexpr auto switchNodeKinds = std::array{ "switch"sv, "case"sv, "match"sv, "break"sv, "end"sv };
+
+        /// <summary>
+        /// Unsigned types a code can be held in, indexed by the log2 of their size in bytes
+        /// </summary>
+        static constexpr auto codeTypes
+            = std::array{ "std::uint8_t"sv, "std::uint16_t"sv, "std::uint32_t"sv, "std::uint64_t"sv };
+
+        static constexpr auto varintBitsPerByte = 7ul;
+
+        /// <summary>
+        /// Up to this many values between the smallest and largest a bitmap checks validity in a single read, wider
+        /// ranges that are not laid out in a table are binary searched
+        /// </summary>
+        static constexpr auto validityBitmapMaxBits = 4096ul;
+
+        /// <summary>
+        /// Up to this many keys a chain of comparisons, each rejecting on length first, is cheaper than dispatching
+        /// </summary>
+        static constexpr auto linearMaxKeys = 4ul;
+
+        /// <summary>
+        /// Up to this many keys the switch tree stays compact, larger enums use the perfect hash
+        /// </summary>
+        static constexpr auto switchMaxKeys = 256ul;
+
+        /// <summary>
+        /// Hashing reads every character where the switch tree reads a few, so long strings favour the tree for
+        /// larger enums
+        /// </summary>
+        static constexpr auto switchMaxKeysForLongStrings = 512ul;
+        static constexpr auto longStringLength = 16ul;
+
+        /// <summary>
+        /// The batch kernel compares each string against every key, past this many keys parsing one string at a time
+        /// with the chosen strategy is faster
+        /// </summary>
+        static constexpr auto batchMaxKeys = 8ul;
+
+        /// <summary>
+        /// String that parses to an item of the enum, folded to lower case when the enum is case insensitive
+        /// </summary>
+        struct ParseKey final
+        {
+            std::string string;
+            std::string_view item;
+        };
+
+        bool isCaseInsensitive(json const & description)
+        {
+            auto field = description.find(caseInsensitiveField);
+            return field != description.end() && field->get<bool>();
+        }
+
+        bool isFlags(json const & description)
+        {
+            auto field = description.find(flagsField);
+            return field != description.end() && field->get<bool>();
+        }
+
+        std::vector<ParseKey> collectParseKeys(json const & description, bool caseInsensitive)
+        {
+            auto keys = std::vector<ParseKey>();
+            auto seen = std::unordered_set<std::string>();
+
+            // A string repeated by a later item or alt is dropped so the first occurrence wins, as it would in a chain
+            // of comparisons. Case insensitive strings are compared after folding so alts differing only by case go
+            auto add = [&](json const & string, std::string_view item) {
+                auto const & value = string.get_ref<std::string const &>();
+                auto key = caseInsensitive ? foldAscii(value) : value;
+                if (seen.insert(key).second)
+                {
+                    keys.push_back(ParseKey{ std::move(key), item });
+                }
+            };
+
+            for (auto const & item : description[itemsArray])
+            {
+                auto const & name = item[itemNameField].get_ref<std::string const &>();
+                add(item[itemStringField], name);
+
+                if (auto alts = item.find(itemAltsArray); alts != item.end())
+                {
+                    for (auto const & alt : *alts)
+                    {
+                        add(alt, name);
+                    }
+                }
+            }
+
+            return keys;
+        }
+
+        ParseStrategy resolveParseStrategy(json const & description, std::span<std::string_view const> keys)
+        {
+            // Without any strings there is nothing to dispatch over
+            if (keys.empty())
+            {
+                return ParseStrategy::Linear;
+            }
+
+            auto strategy = ParseStrategy::Auto;
+            if (auto field = description.find(parseStrategyField); field != description.end())
+            {
+                strategy = toParseStrategy(field->get_ref<std::string const &>()).value_or(ParseStrategy::Auto);
+            }
+
+            return strategy == ParseStrategy::Auto ? chooseParseStrategy(keys) : strategy;
+        }
+
+        /// <summary>
+        /// Value of an item without a value following the given value, the next enumerator or for flags the bit above
+        /// the highest bit set. Returns nothing when it does not fit in 64 bit signed arithmetic
+        /// </summary>
+        std::optional<std::int64_t> followingValue(std::int64_t value, bool flags) noexcept
+        {
+            if (!flags)
+            {
+                return value == std::numeric_limits<std::int64_t>::max() ? std::nullopt : std::optional(value + 1);
+            }
+
+            if (value <= 0)
+            {
+                return 1;
+            }
+
+            auto highest = std::bit_floor(static_cast<std::uint64_t>(value));
+            return highest > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) / 2ul
+                       ? std::nullopt
+                       : std::optional(static_cast<std::int64_t>(highest << 1u));
+        }
+
+        /// <summary>
+        /// Resolves the value of each item, items without a value follow the previous item as C++ enumerators do, or
+        /// take the next bit for flags. Returns nothing when a value does not fit in 64 bit signed arithmetic
+        /// </summary>
+        std::optional<std::vector<std::int64_t>> resolveValues(json const & description, bool flags)
+        {
+            auto values = std::vector<std::int64_t>();
+            auto next = std::optional<std::int64_t>(flags ? 1 : 0);
+
+            for (auto const & item : description[itemsArray])
+            {
+                auto value = next;
+                if (auto field = item.find(itemValueField); field != item.end())
+                {
+                    if (field->is_number_unsigned()
+                        && field->get<std::uint64_t>() > std::numeric_limits<std::int64_t>::max())
+                    {
+                        return std::nullopt;
+                    }
+
+                    value = field->get<std::int64_t>();
+                }
+
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+
+                values.push_back(*value);
+                next = followingValue(*value, flags);
+            }
+
+            return values;
+        }
+
+        json analyzeValues(json const & description, std::span<std::int64_t const> values)
+        {
+            auto const & items = description[itemsArray];
+            auto itemName = [&](std::size_t index) -> std::string const & {
+                return items[index][itemNameField].get_ref<std::string const &>();
+            };
+
+            auto table = buildValueTable(values);
+
+            // Dense tables have an entry for every value between the smallest and the largest, the sparse layout is
+            // only chosen when values are too spread to be without holes
+            auto gapless = table.layout != ValueLayout::Sparse;
+
+            auto entries = json::array();
+            for (auto const & entry : table.entries)
+            {
+                gapless = gapless && entry.item.has_value();
+
+                auto result = json{ { entryValueField, entry.value } };
+                if (entry.item)
+                {
+                    result[keyItemField] = itemName(*entry.item);
+                }
+
+                entries.push_back(std::move(result));
+            }
+
+            return json{ { layoutField, valueLayoutNames[static_cast<std::size_t>(table.layout)] },
+                         { offsetItemField, itemName(*table.entries.front().item) },
+                         { maxItemField, itemName(*table.entries.back().item) },
+                         { gaplessField, gapless },
+                         { tableSizeField, table.entries.size() },
+                         { tableArray, std::move(entries) } };
+        }
+
+        /// <summary>
+        /// Ordinal of each distinct value, the position of the first item with the value. Contiguous when every value
+        /// is the first value plus the ordinal of its item, so ordinals are computed rather than looked up
+        /// </summary>
+        json analyzeOrdinals(json const & description, std::span<std::int64_t const> values)
+        {
+            auto const & items = description[itemsArray];
+
+            auto contiguous = true;
+            auto seen = std::unordered_set<std::int64_t>();
+            auto entries = json::array();
+
+            for (auto index = 0ul; index < values.size(); ++index)
+            {
+                contiguous = contiguous && valueDistance(values[index], values.front()) == index;
+
+                if (seen.insert(values[index]).second)
+                {
+                    entries.push_back(json{ { keyItemField, items[index][itemNameField] }, { ordinalField, index } });
+                }
+            }
+
+            return json{ { contiguousField, contiguous }, { itemsArray, std::move(entries) } };
+        }
+
+        /// <summary>
+        /// Effective values of a flags enum along with the item named by each bit, indexed by bit up to the highest
+        /// named bit. The longest string a flags value formats to is an item name or the named bits joined
+        /// </summary>
+        json analyzeFlags(json const & description, std::span<std::int64_t const> values)
+        {
+            auto const & items = description[itemsArray];
+
+            auto mask = std::uint64_t(0);
+            auto namedBits = std::uint64_t(0);
+            auto bitItems = std::vector<std::optional<std::size_t>>();
+            auto flagItems = json::array();
+            auto maxNameSize = unknownName.size();
+
+            for (auto index = 0ul; index < values.size(); ++index)
+            {
+                auto const & name = items[index][itemNameField].get_ref<std::string const &>();
+                auto value = static_cast<std::uint64_t>(values[index]);
+
+                flagItems.push_back(json{ { itemNameField, name }, { itemValueField, values[index] } });
+                mask |= value;
+                maxNameSize = std::max(maxNameSize, name.size());
+
+                // The first item with a bit names it, as the first item with a value does
+                if (std::has_single_bit(value) && (namedBits & value) == 0u)
+                {
+                    auto bit = static_cast<std::size_t>(std::countr_zero(value));
+                    bitItems.resize(std::max(bitItems.size(), bit + 1ul));
+                    bitItems[bit] = index;
+                    namedBits |= value;
+                }
+            }
+
+            auto bits = json::array();
+            auto joinedSize = 0ul;
+            for (auto bit = 0ul; bit < bitItems.size(); ++bit)
+            {
+                auto entry = json{ { bitField, bit } };
+                if (auto index = bitItems[bit])
+                {
+                    auto const & name = items[*index][itemNameField].get_ref<std::string const &>();
+                    joinedSize += (joinedSize == 0ul ? 0ul : flagSeparator.size()) + name.size();
+                    entry[keyItemField] = name;
+                }
+
+                bits.push_back(std::move(entry));
+            }
+
+            return json{ { maskField, mask },
+                         { namedBitsField, namedBits },
+                         { maxStringSizeField, std::max(maxNameSize, joinedSize) },
+                         { itemsArray, std::move(flagItems) },
+                         { bitsArray, std::move(bits) } };
+        }
+
+        /// <summary>
+        /// Index of the first item with each distinct value, in order of value
+        /// </summary>
+        std::vector<std::size_t> firstItemOfEachValue(std::span<std::int64_t const> values)
+        {
+            auto order = std::vector<std::size_t>(values.size());
+            std::iota(order.begin(), order.end(), 0ul);
+            std::stable_sort(order.begin(), order.end(), [&](auto lhs, auto rhs) { return values[lhs] < values[rhs]; });
+
+            order.erase(
+                std::unique(
+                    order.begin(), order.end(), [&](auto lhs, auto rhs) { return values[lhs] == values[rhs]; }),
+                order.end());
+
+            return order;
+        }
+
+        /// <summary>
+        /// Binary encoding of the values as unsigned codes in the narrowest type that holds them all. Flags encode
+        /// their bits, values that fit a table encode their distance from the smallest value, and sparse values
+        /// encode the ordinal of their item. Codes of items are marked in a bitmap, flags are checked against their
+        /// mask instead
+        /// </summary>
+        json analyzeEncoding(json const & description, std::span<std::int64_t const> values, bool flags, bool sparse)
+        {
+            auto const & items = description[itemsArray];
+            auto result = json::object();
+            auto codes = std::vector<std::uint64_t>();
+
+            if (flags)
+            {
+                result[encodingModeField] = "flags";
+                codes.push_back(0u);
+                for (auto value : values)
+                {
+                    codes.front() |= static_cast<std::uint64_t>(value);
+                }
+            }
+            else if (!sparse)
+            {
+                result[encodingModeField] = "value";
+
+                auto min = *std::min_element(values.begin(), values.end());
+                for (auto value : values)
+                {
+                    codes.push_back(valueDistance(value, min));
+                }
+            }
+            else
+            {
+                result[encodingModeField] = "ordinal";
+
+                // Items sharing a value share the ordinal of the first of them, so only that ordinal is a code
+                auto sorted = json::array();
+                for (auto index : firstItemOfEachValue(values))
+                {
+                    codes.push_back(index);
+                    sorted.push_back(json{ { keyItemField, items[index][itemNameField] }, { ordinalField, index } });
+                }
+
+                result[sortedArray] = std::move(sorted);
+            }
+
+            auto maxCode = *std::max_element(codes.begin(), codes.end());
+            auto codeBits = static_cast<std::size_t>(std::bit_width(maxCode));
+            auto codeBytes = std::max(std::bit_ceil((codeBits + 7ul) / 8ul), 1ul);
+
+            result[codeBitsField] = codeBits;
+            result[codeTypeField] = codeTypes[static_cast<std::size_t>(std::countr_zero(codeBytes))];
+            result[varintSizeField] = std::max((codeBits + varintBitsPerByte - 1ul) / varintBitsPerByte, 1ul);
+
+            if (!flags)
+            {
+                auto codeCount = sparse ? values.size() : static_cast<std::size_t>(maxCode) + 1ul;
+                auto bitmap = std::vector<std::uint64_t>((codeCount + 63ul) / 64ul, 0u);
+                for (auto code : codes)
+                {
+                    bitmap[code / 64u] |= std::uint64_t(1) << (code % 64u);
+                }
+
+                result[codeCountField] = codeCount;
+                result[bitmapArray] = std::move(bitmap);
+            }
+
+            return result;
+        }
+
+        /// <summary>
+        /// How a raw underlying value is checked to be the value of an item. Flags check their mask, values in a table
+        /// or a small range check a bitmap of the distance from the smallest value, and others are binary searched in
+        /// the distinct values sorted by value, which sparse values always carry for their ordinal codes
+        /// </summary>
+        json analyzeValidity(json const & description, std::span<std::int64_t const> values, bool flags, bool sparse)
+        {
+            if (flags)
+            {
+                return json{ { layoutField, "mask" } };
+            }
+
+            auto const & items = description[itemsArray];
+            auto [min, max] = std::minmax_element(values.begin(), values.end());
+
+            auto range = valueDistance(*max, *min);
+            auto result = json::object();
+
+            if (!sparse || range < validityBitmapMaxBits)
+            {
+                auto bitCount = static_cast<std::size_t>(range) + 1ul;
+                auto bitmap = std::vector<std::uint64_t>((bitCount + 63ul) / 64ul, 0u);
+                for (auto value : values)
+                {
+                    auto distance = valueDistance(value, *min);
+                    bitmap[distance / 64u] |= std::uint64_t(1) << (distance % 64u);
+                }
+
+                result[layoutField] = "bitmap";
+                result[bitCountField] = bitCount;
+                result[bitmapArray] = std::move(bitmap);
+            }
+            else
+            {
+                result[layoutField] = "sorted";
+            }
+
+            if (sparse)
+            {
+                auto sorted = json::array();
+                for (auto index : firstItemOfEachValue(values))
+                {
+                    sorted.push_back(items[index][itemNameField]);
+                }
+
+                result[sortedArray] = std::move(sorted);
+            }
+
+            return result;
+        }
+
+        void appendOctal(std::string & output, unsigned char byte)
+        {
+            static constexpr auto octalDigits = "01234567"sv;
+
+            // Octal escapes stop after three digits so a following digit cannot extend them, unlike hex
+            output.push_back('\\');
+            output.push_back(octalDigits[(byte >> 6u) & 7u]);
+            output.push_back(octalDigits[(byte >> 3u) & 7u]);
+            output.push_back(octalDigits[byte & 7u]);
+        }
+
+        std::string characterLiteral(unsigned char byte)
+        {
+            auto result = std::string("'");
+            if (byte == '\'')
+            {
+                result.append("\\'");
+            }
+            else if (byte >= 0x80u)
+            {
+                appendOctal(result, byte);
+            }
+            else
+            {
+                result.append(escapeStringLiteral(std::string_view(reinterpret_cast<char const *>(&byte), 1ul)));
+            }
+
+            result.push_back('\'');
+            return result;
+        }
+
+        json toJson(ParseKey const & key)
+        {
+            return json{ { keyStringField, key.string },
+                         { keyLiteralField, escapeStringLiteral(key.string) },
+                         { keyItemField, key.item } };
+        }
+
+        /// <summary>
+        /// First eight bytes of each parse key read as a little endian word, zero padded for shorter keys, so a batch
+        /// of strings is matched against every key a word at a time
+        /// </summary>
+        json analyzeBatchPrefixes(std::span<ParseKey const> keys)
+        {
+            auto prefixes = json::array();
+            for (auto const & key : keys)
+            {
+                auto prefix = std::uint64_t(0);
+                for (auto index = 0ul; index < std::min(key.string.size(), sizeof(prefix)); ++index)
+                {
+                    prefix |= std::uint64_t(static_cast<unsigned char>(key.string[index])) << (index * 8ul);
+                }
+
+                prefixes.push_back(prefix);
+            }
+
+            return prefixes;
+        }
+
+        json analyzePerfectHash(std::span<ParseKey const> keys, std::span<std::string_view const> strings)
+        {
+            auto hash = buildPerfectHash(strings);
+
+            auto slots = json::array();
+            for (auto key : hash.slots)
+            {
+                slots.push_back(toJson(keys[key]));
+            }
+
+            return json{ { bucketCountField, hash.seeds.size() },
+                         { tableSizeField, hash.slots.size() },
+                         { seedsArray, hash.seeds },
+                         { slotsArray, std::move(slots) } };
+        }
+
+        json analyzeSwitchTree(std::span<ParseKey const> keys, std::span<std::string_view const> strings)
+        {
+            auto nodes = json::array();
+
+            // Case labels are lengths or characters depending on the switch they belong to
+            auto onLength = std::vector<bool>();
+
+            for (auto const & node : buildSwitchTree(strings))
+            {
+                auto result = json{ { nodeKindField, switchNodeKinds[static_cast<std::size_t>(node.kind)] },
+                                    { nodeDepthField, node.depth },
+                                    { nodeIndentField, std::string(node.depth * 4ul, ' ') } };
+
+                switch (node.kind)
+                {
+                case SwitchNode::Kind::Switch:
+                    onLength.push_back(node.value == SwitchNode::lengthPosition);
+                    if (!onLength.back())
+                    {
+                        result[nodePositionField] = node.value;
+                    }
+                    break;
+
+                case SwitchNode::Kind::Case:
+                    result[nodeLabelField] = onLength.back() ? std::to_string(node.value)
+                                                             : characterLiteral(static_cast<unsigned char>(node.value));
+                    break;
+
+                case SwitchNode::Kind::Match:
+                    result[keyLiteralField] = escapeStringLiteral(keys[node.value].string);
+                    result[keyItemField] = keys[node.value].item;
+                    break;
+
+                case SwitchNode::Kind::Break: break;
+
+                case SwitchNode::Kind::End: onLength.pop_back(); break;
+                }
+
+                nodes.push_back(std::move(result));
+            }
+
+            return nodes;
+        }
+
+    }  // namespace
+
+
+    std::string escapeStringLiteral(std::string_view value)
+    {
+        auto result = std::string();
+        result.reserve(value.size());
+
+        for (auto c : value)
+        {
+            switch (c)
+            {
+            case '"': result.append("\\\""); break;
+            case '\\': result.append("\\\\"); break;
+            case '\n': result.append("\\n"); break;
+            case '\r': result.append("\\r"); break;
+            case '\t': result.append("\\t"); break;
+            default:
+                if (auto byte = static_cast<unsigned char>(c); byte < 0x20u || byte == 0x7fu)
+                {
+                    appendOctal(result, byte);
+                }
+                else
+                {
+                    result.push_back(c);
+                }
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    std::string foldAscii(std::string_view value)
+    {
+        auto result = std::string(value);
+        for (auto & c : result)
+        {
+            if (c >= 'A' && c <= 'Z')
+            {
+                c = static_cast<char>(c | 0x20);
+            }
+        }
+
+        return result;
+    }
+
+    ParseStrategy chooseParseStrategy(std::span<std::string_view const> keys) noexcept
+    {
+        if (keys.size() <= linearMaxKeys)
+        {
+            return ParseStrategy::Linear;
+        }
+
+        auto totalLength = std::accumulate(
+            keys.begin(), keys.end(), 0ul, [](auto total, auto key) { return total + key.size(); });
+
+        auto maxKeys = totalLength / keys.size() >= longStringLength ? switchMaxKeysForLongStrings : switchMaxKeys;
+
+        return keys.size() <= maxKeys ? ParseStrategy::Switch : ParseStrategy::Hash;
+    }
+
+    std::optional<std::vector<std::int64_t>> resolveItemValues(json const & description)
+    {
+        return resolveValues(description, isFlags(description));
+    }
+
+    void resolveDescription(json & description)
+    {
+        auto values = resolveValues(description, isFlags(description));
+        if (!values)
+        {
+            return;
+        }
+
+        auto & items = description[itemsArray];
+        for (auto index = 0ul; index < values->size(); ++index)
+        {
+            items[index][itemValueField] = (*values)[index];
+        }
+
+        if (!description.contains(underlyingTypeField))
+        {
+            description[underlyingTypeField] = narrowestUnderlyingType(*values).name;
+        }
+    }
+
+    json analyzeEnum(json const & description)
+    {
+        auto caseInsensitive = isCaseInsensitive(description);
+        auto keys = collectParseKeys(description, caseInsensitive);
+
+        auto strings = std::vector<std::string_view>();
+        strings.reserve(keys.size());
+        for (auto const & key : keys)
+        {
+            strings.push_back(key.string);
+        }
+
+        auto strategy = resolveParseStrategy(description, strings);
+
+        auto analysis = json::object();
+        analysis[parseStrategyField] = toString(strategy);
+        analysis[caseInsensitiveField] = caseInsensitive;
+
+        auto & parseKeys = analysis[parseKeysArray] = json::array();
+        for (auto const & key : keys)
+        {
+            parseKeys.push_back(toJson(key));
+        }
+
+        auto flags = isFlags(description);
+        auto values = resolveValues(description, flags);
+
+        if (values && !values->empty())
+        {
+            analysis[valuesField] = analyzeValues(description, *values);
+            analysis[ordinalsField] = analyzeOrdinals(description, *values);
+        }
+
+        if (flags)
+        {
+            if (!values)
+            {
+                throw std::runtime_error("Flags do not fit in 64 bit signed values");
+            }
+
+            analysis[flagsField] = analyzeFlags(description, *values);
+        }
+
+        if (values && !values->empty())
+        {
+            auto sparseName = valueLayoutNames[static_cast<std::size_t>(ValueLayout::Sparse)];
+            auto sparse = analysis[valuesField][layoutField].get<std::string_view>() == sparseName;
+            analysis[validityField] = analyzeValidity(description, *values, flags, sparse);
+            analysis[encodingField] = analyzeEncoding(description, *values, flags, sparse);
+        }
+
+        if (!keys.empty() && keys.size() <= batchMaxKeys)
+        {
+            analysis[batchPrefixesArray] = analyzeBatchPrefixes(keys);
+        }
+
+        // Only the lookup for the chosen strategy is built
+        switch (strategy)
+        {
+        case ParseStrategy::Hash: analysis[perfectHashField] = analyzePerfectHash(keys, strings); break;
+        case ParseStrategy::Switch: analysis[switchTreeArray] = analyzeSwitchTree(keys, strings); break;
+        case ParseStrategy::Auto:
+        case ParseStrategy::Linear: break;
+        }
+
+        return analysis;
+    }
+
+}  // namespace enumgen
\ No newline at end of file
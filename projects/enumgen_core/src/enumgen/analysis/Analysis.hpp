@@ -0,0 +1,52 @@
+#pragma once
+
+#include <enumgen/analysis/ParseStrategy.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// Escapes a string so it can be placed between the quotes of a C++ string literal
+    /// </summary>
+    [[nodiscard]] std::string escapeStringLiteral(std::string_view value);
+
+    /// <summary>
+    /// Folds the ASCII letters of a string to lower case, other characters are left as they are
+    /// </summary>
+    [[nodiscard]] std::string foldAscii(std::string_view value);
+
+    /// <summary>
+    /// Chooses the parse strategy for an enum with the given strings from their number and mean length
+    /// </summary>
+    [[nodiscard]] ParseStrategy chooseParseStrategy(std::span<std::string_view const> keys) noexcept;
+
+    /// <summary>
+    /// Resolves the value of each item of a validated enum description, items without a value follow the previous
+    /// item or for flags take the next bit. Returns nothing when a value does not fit in 64 bit signed arithmetic
+    /// </summary>
+    [[nodiscard]] std::optional<std::vector<std::int64_t>> resolveItemValues(nlohmann::json const & description);
+
+    /// <summary>
+    /// Writes the resolved value into every item of a validated enum description so templates see the values C++
+    /// gives the enumerators, and the narrowest underlying type holding them when the description names none. A
+    /// description whose values do not fit in 64 bit signed arithmetic is left as it is
+    /// </summary>
+    void resolveDescription(nlohmann::json & description);
+
+    /// <summary>
+    /// Analyzes a validated enum description, the result is rendered under 'analysis' next to the description so
+    /// templates can generate lookups without recomputing them
+    /// </summary>
+    [[nodiscard]] nlohmann::json analyzeEnum(nlohmann::json const & description);
+
+}  // namespace enumgen
\ No newline at end of file
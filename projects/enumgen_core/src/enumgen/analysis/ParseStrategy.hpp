@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// How generated code looks up the enum value for a string
+    /// </summary>
+    enum class ParseStrategy : std::uint8_t
+    {
+        /// <summary>
+        /// Chosen by enumgen from the number and lengths of the strings
+        /// </summary>
+        Auto,
+
+        /// <summary>
+        /// Minimal perfect hash, one hash, one table probe and one comparison
+        /// </summary>
+        Hash,
+
+        /// <summary>
+        /// Nested switch statements over the length and distinguishing characters, then one comparison
+        /// </summary>
+        Switch,
+
+        /// <summary>
+        /// Comparison against each string in turn
+        /// </summary>
+        Linear
+    };
+
+    /// <summary>
+    /// Names of the parse strategies as written in a specification, indexed by ParseStrategy
+    /// </summary>
+    inline constexpr auto parseStrategyNames = std::array<std::string_view, 4ul>{ "auto", "hash", "switch", "linear" };
+
+    [[nodiscard]] constexpr std::string_view toString(ParseStrategy strategy) noexcept
+    {
+        return parseStrategyNames[static_cast<std::size_t>(strategy)];
+    }
+
+    [[nodiscard]] constexpr std::optional<ParseStrategy> toParseStrategy(std::string_view name) noexcept
+    {
+        for (auto index = 0ul; index < parseStrategyNames.size(); ++index)
+        {
+            if (parseStrategyNames[index] == name)
+            {
+                return static_cast<ParseStrategy>(index);
+            }
+        }
+
+        return std::nullopt;
+    }
+
+}  // namespace enumgen
\ No newline at end of file
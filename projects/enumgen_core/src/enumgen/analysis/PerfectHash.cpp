@@ -0,0 +1,125 @@
+#include <enumgen/analysis/PerfectHash.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+
+namespace enumgen
+{
+    namespace
+    {
+
+        static constexpr auto emptySlot = std::numeric_limits<std::size_t>::max();
+
+        /// <summary>
+        /// Seeds tried for a single bucket before giving up on the bucket count
+        /// </summary>
+        static constexpr auto maxSeedAttempts = 1u << 20u;
+
+        bool tryBuild(std::span<std::uint64_t const> hashes, std::size_t bucketCount, PerfectHash & result)
+        {
+            auto tableSize = hashes.size();
+
+            auto buckets = std::vector<std::vector<std::size_t>>(bucketCount);
+            for (auto index = 0ul; index < hashes.size(); ++index)
+            {
+                buckets[hashes[index] % bucketCount].push_back(index);
+            }
+
+            // Large buckets are placed while most of the table is free, single keys then fill the remaining gaps
+            auto order = std::vector<std::size_t>(bucketCount);
+            std::iota(order.begin(), order.end(), 0ul);
+            std::stable_sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+                return buckets[lhs].size() > buckets[rhs].size();
+            });
+
+            result.seeds.assign(bucketCount, 0u);
+            result.slots.assign(tableSize, emptySlot);
+
+            auto candidate = std::vector<std::size_t>();
+            for (auto bucketIndex : order)
+            {
+                auto const & bucket = buckets[bucketIndex];
+                if (bucket.empty())
+                {
+                    break;
+                }
+
+                auto placed = false;
+                for (auto seed = 0u; !placed && seed < maxSeedAttempts; ++seed)
+                {
+                    candidate.clear();
+                    for (auto key : bucket)
+                    {
+                        auto slot = perfectHashMix(hashes[key] ^ seed) % tableSize;
+                        if (result.slots[slot] != emptySlot
+                            || std::find(candidate.begin(), candidate.end(), slot) != candidate.end())
+                        {
+                            break;
+                        }
+
+                        candidate.push_back(slot);
+                    }
+
+                    if (candidate.size() == bucket.size())
+                    {
+                        placed = true;
+                        result.seeds[bucketIndex] = seed;
+                        for (auto index = 0ul; index < bucket.size(); ++index)
+                        {
+                            result.slots[candidate[index]] = bucket[index];
+                        }
+                    }
+                }
+
+                if (!placed)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+    }  // namespace
+
+
+    PerfectHash buildPerfectHash(std::span<std::string_view const> keys)
+    {
+        auto result = PerfectHash{};
+        if (keys.empty())
+        {
+            return result;
+        }
+
+        auto hashes = std::vector<std::uint64_t>();
+        hashes.reserve(keys.size());
+        std::transform(keys.begin(), keys.end(), std::back_inserter(hashes), [](auto key) { return fnv1a(key); });
+
+        // Keys sharing a full hash land in the same slot whatever the seed
+        auto sorted = hashes;
+        std::sort(sorted.begin(), sorted.end());
+        if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end())
+        {
+            throw std::runtime_error("Unable to build a perfect hash over keys with the same hash");
+        }
+
+        // Two keys per bucket keeps the seed table small, more buckets are only needed when a seed search fails
+        auto bucketCount = (keys.size() + 1ul) / 2ul;
+        while (!tryBuild(hashes, bucketCount, result))
+        {
+            if (bucketCount == keys.size())
+            {
+                throw std::runtime_error("Unable to find seeds for a perfect hash");
+            }
+
+            bucketCount = std::min(bucketCount * 2ul, keys.size());
+        }
+
+        return result;
+    }
+
+}  // namespace enumgen
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <enumgen/utils/Hash.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// Minimal perfect hash over a set of distinct keys built with hash and displace. Each key hashes into a bucket
+    /// and the seed of the bucket displaces every key in that bucket into a slot of its own, so a table with one
+    /// slot per key is filled without collisions
+    /// </summary>
+    struct PerfectHash final
+    {
+        /// <summary>
+        /// Displacement seed of each bucket
+        /// </summary>
+        std::vector<std::uint32_t> seeds;
+
+        /// <summary>
+        /// Index of the key held in each slot of the table
+        /// </summary>
+        std::vector<std::size_t> slots;
+    };
+
+
+    /// <summary>
+    /// Finalizer that spreads the bits of a hash displaced by a bucket seed across the whole word
+    /// </summary>
+    [[nodiscard]] constexpr std::uint64_t perfectHashMix(std::uint64_t value) noexcept
+    {
+        value ^= value >> 33u;
+        value *= 0xff51afd7ed558ccdull;
+        value ^= value >> 33u;
+        value *= 0xc4ceb9fe1a85ec53ull;
+        value ^= value >> 33u;
+        return value;
+    }
+
+    /// <summary>
+    /// Returns the slot of the key with the given fnv1a hash, generated lookups must compute the same slot
+    /// </summary>
+    [[nodiscard]] constexpr std::size_t perfectHashSlot(
+        std::uint64_t hash, std::span<std::uint32_t const> seeds, std::size_t tableSize) noexcept
+    {
+        auto seed = seeds[hash % seeds.size()];
+        return perfectHashMix(hash ^ seed) % tableSize;
+    }
+
+    /// <summary>
+    /// Builds a minimal perfect hash over the keys, which must be distinct. Throws if no seeds can be found
+    /// </summary>
+    [[nodiscard]] PerfectHash buildPerfectHash(std::span<std::string_view const> keys);
+
+}  // namespace enumgen
\ No newline at end of file
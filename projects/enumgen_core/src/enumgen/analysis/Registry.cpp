@@ -0,0 +1,122 @@
+#include <enumgen/analysis/Analysis.hpp>
+#include <enumgen/analysis/Registry.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <string_view>
+
+
+using namespace nlohmann;
+using namespace std::string_view_literals;
+
+
+namespace enumgen
+{
+    namespace
+    {
+
+        static constexpr std::string_view nameField = "name"sv;
+        static constexpr std::string_view namespaceField = "namespace"sv;
+        static constexpr std::string_view itemsArray = "items"sv;
+        static constexpr std::string_view valuesArray = "values"sv;
+        static constexpr std::string_view enumsArray = "enums"sv;
+        static constexpr std::string_view valueField = "value"sv;
+        static constexpr std::string_view itemsOffsetField = "itemsOffset"sv;
+        static constexpr std::string_view itemCountField = "itemCount"sv;
+        static constexpr std::string_view valuesOffsetField = "valuesOffset"sv;
+        static constexpr std::string_view valueCountField = "valueCount"sv;
+
+        /// <summary>
+        /// Writes a value as a C++ literal, the smallest value has no literal of its own so it is written as an
+        /// expression
+        /// </summary>
+        std::string valueLiteral(std::int64_t value)
+        {
+            if (value == std::numeric_limits<std::int64_t>::min())
+            {
+                return "(-9223372036854775807LL - 1)";
+            }
+
+            return std::to_string(value) + "LL";
+        }
+
+        json toJson(RegistryItem const & item)
+        {
+            return json{ { nameField, item.name }, { valueField, valueLiteral(item.value) } };
+        }
+
+    }  // namespace
+
+    std::optional<RegistryEnum> makeRegistryEnum(json const & description)
+    {
+        auto values = resolveItemValues(description);
+        if (!values)
+        {
+            return std::nullopt;
+        }
+
+        auto result = RegistryEnum{ description[namespaceField].get<std::string>() + "::"
+                                        + description[nameField].get<std::string>(),
+                                    {} };
+
+        auto const & items = description[itemsArray];
+        for (auto index = 0ul; index < values->size(); ++index)
+        {
+            result.items.push_back(RegistryItem{ items[index][nameField].get<std::string>(), (*values)[index] });
+        }
+
+        return result;
+    }
+
+    json analyzeRegistry(std::vector<RegistryEnum> enums)
+    {
+        std::stable_sort(
+            enums.begin(), enums.end(), [](auto const & lhs, auto const & rhs) { return lhs.name < rhs.name; });
+
+        auto enumEntries = json::array();
+        auto itemEntries = json::array();
+        auto valueEntries = json::array();
+
+        for (auto & registryEnum : enums)
+        {
+            // Sorting by value is stable so the first item with each value is kept, as ToString names it
+            auto byValue = registryEnum.items;
+            std::stable_sort(byValue.begin(), byValue.end(), [](auto const & lhs, auto const & rhs) {
+                return lhs.value < rhs.value;
+            });
+
+            byValue.erase(
+                std::unique(
+                    byValue.begin(),
+                    byValue.end(),
+                    [](auto const & lhs, auto const & rhs) { return lhs.value == rhs.value; }),
+                byValue.end());
+
+            auto & byName = registryEnum.items;
+            std::stable_sort(byName.begin(), byName.end(), [](auto const & lhs, auto const & rhs) {
+                return lhs.name < rhs.name;
+            });
+
+            enumEntries.push_back(json{ { nameField, registryEnum.name },
+                                        { itemsOffsetField, itemEntries.size() },
+                                        { itemCountField, registryEnum.items.size() },
+                                        { valuesOffsetField, valueEntries.size() },
+                                        { valueCountField, byValue.size() } });
+
+            for (auto const & item : registryEnum.items)
+            {
+                itemEntries.push_back(toJson(item));
+            }
+
+            for (auto const & item : byValue)
+            {
+                valueEntries.push_back(toJson(item));
+            }
+        }
+
+        return json{ { enumsArray, std::move(enumEntries) },
+                     { itemsArray, std::move(itemEntries) },
+                     { valuesArray, std::move(valueEntries) } };
+    }
+
+}  // namespace enumgen
\ No newline at end of file
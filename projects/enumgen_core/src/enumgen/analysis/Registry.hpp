@@ -0,0 +1,53 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// Item of an enum in the registry with its resolved value
+    /// </summary>
+    struct RegistryItem final
+    {
+        std::string name;
+        std::int64_t value;
+    };
+
+    /// <summary>
+    /// Enum in the registry, kept from its description so the registry is built after the descriptions are discarded
+    /// </summary>
+    struct RegistryEnum final
+    {
+        /// <summary>
+        /// Name of the enum qualified by its namespace
+        /// </summary>
+        std::string name;
+
+        /// <summary>
+        /// Items in specification order
+        /// </summary>
+        std::vector<RegistryItem> items;
+    };
+
+
+    /// <summary>
+    /// Collects the registry entry of a validated enum description, nothing when its values do not fit in 64 bit
+    /// signed arithmetic
+    /// </summary>
+    [[nodiscard]] std::optional<RegistryEnum> makeRegistryEnum(nlohmann::json const & description);
+
+    /// <summary>
+    /// Lays out the registry of every enum for the registry templates. Enums are sorted by name, each with a run of
+    /// its items sorted by name and a run of its distinct values sorted by value, so every lookup in the generated
+    /// tables is a binary search
+    /// </summary>
+    [[nodiscard]] nlohmann::json analyzeRegistry(std::vector<RegistryEnum> enums);
+
+}  // namespace enumgen
\ No newline at end of file
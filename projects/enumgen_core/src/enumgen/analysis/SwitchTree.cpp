@@ -0,0 +1,150 @@
+#include <enumgen/analysis/SwitchTree.hpp>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+
+namespace enumgen
+{
+    namespace
+    {
+
+        class SwitchTreeBuilder final
+        {
+        private:
+            std::span<std::string_view const> keys;
+            std::vector<SwitchNode> nodes;
+
+        public:
+            explicit SwitchTreeBuilder(std::span<std::string_view const> keys) noexcept : keys(keys)
+            { }
+
+            std::vector<SwitchNode> build()
+            {
+                auto order = std::vector<std::size_t>(keys.size());
+                for (auto index = 0ul; index < keys.size(); ++index)
+                {
+                    order[index] = index;
+                }
+
+                std::stable_sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+                    return keys[lhs].size() < keys[rhs].size();
+                });
+
+                addGroups(order, SwitchNode::lengthPosition, 0ul);
+
+                return std::move(nodes);
+            }
+
+        private:
+            void add(SwitchNode::Kind kind, std::size_t depth, std::size_t value = 0ul)
+            {
+                nodes.push_back(SwitchNode{ kind, depth, value });
+            }
+
+            [[nodiscard]] std::size_t labelOf(std::size_t key, std::size_t position) const noexcept
+            {
+                return position == SwitchNode::lengthPosition ? keys[key].size()
+                                                              : static_cast<unsigned char>(keys[key][position]);
+            }
+
+            /// <summary>
+            /// Emits a switch over position for keys already ordered by their label at that position
+            /// </summary>
+            void addGroups(std::span<std::size_t> group, std::size_t position, std::size_t depth)
+            {
+                add(SwitchNode::Kind::Switch, depth, position);
+
+                auto begin = group.begin();
+                while (begin != group.end())
+                {
+                    auto label = labelOf(*begin, position);
+                    auto end = std::find_if(
+                        begin, group.end(), [&](auto key) { return labelOf(key, position) != label; });
+
+                    add(SwitchNode::Kind::Case, depth, label);
+                    addKeys(std::span{ begin, end }, depth + 1ul);
+                    add(SwitchNode::Kind::Break, depth + 1ul);
+
+                    begin = end;
+                }
+
+                add(SwitchNode::Kind::End, depth);
+            }
+
+            /// <summary>
+            /// Emits the tree for keys of the same length
+            /// </summary>
+            void addKeys(std::span<std::size_t> group, std::size_t depth)
+            {
+                if (group.size() == 1ul)
+                {
+                    add(SwitchNode::Kind::Match, depth, group.front());
+                    return;
+                }
+
+                auto position = choosePosition(group);
+                std::stable_sort(group.begin(), group.end(), [&](auto lhs, auto rhs) {
+                    return labelOf(lhs, position) < labelOf(rhs, position);
+                });
+
+                addGroups(group, position, depth);
+            }
+
+            /// <summary>
+            /// Picks the position splitting the keys into the most groups, then the one with the smallest largest group
+            /// </summary>
+            [[nodiscard]] std::size_t choosePosition(std::span<std::size_t const> group) const
+            {
+                auto length = keys[group.front()].size();
+
+                auto bestPosition = 0ul;
+                auto bestGroups = 0ul;
+                auto bestLargest = group.size();
+
+                for (auto position = 0ul; position < length; ++position)
+                {
+                    auto counts = std::array<std::size_t, 256ul>{};
+                    auto groups = 0ul;
+                    auto largest = 0ul;
+
+                    for (auto key : group)
+                    {
+                        auto & count = counts[labelOf(key, position)];
+                        groups += count == 0ul ? 1ul : 0ul;
+                        largest = std::max(largest, ++count);
+                    }
+
+                    if (groups > bestGroups || (groups == bestGroups && largest < bestLargest))
+                    {
+                        bestPosition = position;
+                        bestGroups = groups;
+                        bestLargest = largest;
+                    }
+                }
+
+                // Equal keys agree at every position and would never be separated
+                if (bestGroups < 2ul)
+                {
+                    throw std::runtime_error("Unable to build a switch tree over duplicate keys");
+                }
+
+                return bestPosition;
+            }
+        };
+
+    }  // namespace
+
+
+    std::vector<SwitchNode> buildSwitchTree(std::span<std::string_view const> keys)
+    {
+        if (keys.empty())
+        {
+            return {};
+        }
+
+        return SwitchTreeBuilder(keys).build();
+    }
+
+}  // namespace enumgen
\ No newline at end of file
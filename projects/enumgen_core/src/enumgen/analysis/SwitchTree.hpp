@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// Single statement of a decision tree that dispatches on the length of a string and then on the characters that
+    /// distinguish the strings of that length. The tree is flattened in the order the statements are written so
+    /// templates can emit it with a single loop
+    /// </summary>
+    struct SwitchNode final
+    {
+        enum class Kind : std::uint8_t
+        {
+            /// <summary>
+            /// Opens a switch over the length, or over the character at position
+            /// </summary>
+            Switch,
+
+            /// <summary>
+            /// Case label of the enclosing switch, a length or a character
+            /// </summary>
+            Case,
+
+            /// <summary>
+            /// Compares the string against the only key left on this path
+            /// </summary>
+            Match,
+
+            /// <summary>
+            /// Leaves the enclosing switch
+            /// </summary>
+            Break,
+
+            /// <summary>
+            /// Closes the innermost open switch
+            /// </summary>
+            End
+        };
+
+        /// <summary>
+        /// Position used by a length switch
+        /// </summary>
+        static constexpr auto lengthPosition = static_cast<std::size_t>(-1);
+
+        Kind kind;
+
+        /// <summary>
+        /// Nesting depth of the statement, the outermost switch is at depth 0
+        /// </summary>
+        std::size_t depth;
+
+        /// <summary>
+        /// Switch: character position switched over, or lengthPosition. Case: the length or character value.
+        /// Match: index of the key
+        /// </summary>
+        std::size_t value;
+    };
+
+
+    /// <summary>
+    /// Builds a decision tree over the keys, which must be distinct. At each node the character position splitting
+    /// the remaining keys into the most groups is switched over until a single key is left
+    /// </summary>
+    [[nodiscard]] std::vector<SwitchNode> buildSwitchTree(std::span<std::string_view const> keys);
+
+}  // namespace enumgen
\ No newline at end of file
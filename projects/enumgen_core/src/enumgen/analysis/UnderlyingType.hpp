@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// Integral type an enum can be based on along with the range of values it holds on every platform
+    /// </summary>
+    struct UnderlyingType final
+    {
+        std::string_view name;
+        std::int64_t min;
+        std::uint64_t max;
+
+        [[nodiscard]] constexpr bool holds(std::int64_t value) const noexcept
+        {
+            return value >= min && (value < 0 || static_cast<std::uint64_t>(value) <= max);
+        }
+    };
+
+    namespace detail
+    {
+
+        template <typename Integral>
+        [[nodiscard]] constexpr UnderlyingType makeUnderlyingType(std::string_view name) noexcept
+        {
+            return UnderlyingType{ name,
+                                   static_cast<std::int64_t>(std::numeric_limits<Integral>::min()),
+                                   static_cast<std::uint64_t>(std::numeric_limits<Integral>::max()) };
+        }
+
+        /// <summary>
+        /// Fixed width types from narrowest to widest, signed before unsigned of the same width
+        /// </summary>
+        inline constexpr auto fixedWidthTypes = std::array{
+            makeUnderlyingType<std::int8_t>("std::int8_t"),   makeUnderlyingType<std::uint8_t>("std::uint8_t"),
+            makeUnderlyingType<std::int16_t>("std::int16_t"), makeUnderlyingType<std::uint16_t>("std::uint16_t"),
+            makeUnderlyingType<std::int32_t>("std::int32_t"), makeUnderlyingType<std::uint32_t>("std::uint32_t"),
+            makeUnderlyingType<std::int64_t>("std::int64_t"), makeUnderlyingType<std::uint64_t>("std::uint64_t"),
+        };
+
+        /// <summary>
+        /// Other spellings of the integral types. The widths of long and the signedness of char differ between
+        /// platforms, so they hold only the values every platform agrees on
+        /// </summary>
+        inline constexpr auto aliasTypes = std::array{
+            makeUnderlyingType<std::int8_t>("int8_t"),
+            makeUnderlyingType<std::int8_t>("signed char"),
+            UnderlyingType{ "char", 0, static_cast<std::uint64_t>(std::numeric_limits<std::int8_t>::max()) },
+            makeUnderlyingType<std::uint8_t>("uint8_t"),
+            makeUnderlyingType<std::uint8_t>("unsigned char"),
+            makeUnderlyingType<std::int16_t>("int16_t"),
+            makeUnderlyingType<std::int16_t>("short"),
+            makeUnderlyingType<std::uint16_t>("uint16_t"),
+            makeUnderlyingType<std::uint16_t>("unsigned short"),
+            makeUnderlyingType<std::int32_t>("int32_t"),
+            makeUnderlyingType<std::int32_t>("int"),
+            makeUnderlyingType<std::int32_t>("long"),
+            makeUnderlyingType<std::uint32_t>("uint32_t"),
+            makeUnderlyingType<std::uint32_t>("unsigned"),
+            makeUnderlyingType<std::uint32_t>("unsigned int"),
+            makeUnderlyingType<std::uint32_t>("unsigned long"),
+            makeUnderlyingType<std::int64_t>("int64_t"),
+            makeUnderlyingType<std::int64_t>("long long"),
+            makeUnderlyingType<std::uint64_t>("uint64_t"),
+            makeUnderlyingType<std::uint64_t>("unsigned long long"),
+        };
+
+    }  // namespace detail
+
+    /// <summary>
+    /// Finds an integral type by the name a specification writes it with, nothing for names enumgen does not know
+    /// such as user aliases
+    /// </summary>
+    [[nodiscard]] constexpr std::optional<UnderlyingType> findUnderlyingType(std::string_view name) noexcept
+    {
+        for (auto const & type : detail::fixedWidthTypes)
+        {
+            if (type.name == name)
+            {
+                return type;
+            }
+        }
+
+        for (auto const & type : detail::aliasTypes)
+        {
+            if (type.name == name)
+            {
+                return type;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    /// <summary>
+    /// Narrowest fixed width type holding every value, unsigned when no value is negative
+    /// </summary>
+    [[nodiscard]] constexpr UnderlyingType narrowestUnderlyingType(std::span<std::int64_t const> values) noexcept
+    {
+        auto negative = false;
+        for (auto value : values)
+        {
+            negative = negative || value < 0;
+        }
+
+        for (auto const & type : detail::fixedWidthTypes)
+        {
+            if ((type.min < 0) != negative)
+            {
+                continue;
+            }
+
+            auto holdsAll = true;
+            for (auto value : values)
+            {
+                holdsAll = holdsAll && type.holds(value);
+            }
+
+            if (holdsAll)
+            {
+                return type;
+            }
+        }
+
+        return detail::fixedWidthTypes.back();
+    }
+
+}  // namespace enumgen
\ No newline at end of file
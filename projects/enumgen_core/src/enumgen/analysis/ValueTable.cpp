@@ -0,0 +1,59 @@
+#include <enumgen/analysis/ValueTable.hpp>
+
+#include <algorithm>
+
+
+namespace enumgen
+{
+
+    ValueTable buildValueTable(std::span<std::int64_t const> values)
+    {
+        // Sorting by value then item keeps the first item of each value at the front of its run
+        auto sorted = std::vector<ValueEntry>();
+        sorted.reserve(values.size());
+        for (auto index = 0ul; index < values.size(); ++index)
+        {
+            sorted.push_back(ValueEntry{ values[index], index });
+        }
+
+        std::stable_sort(sorted.begin(), sorted.end(), [](auto const & lhs, auto const & rhs) {
+            return lhs.value < rhs.value;
+        });
+
+        sorted.erase(
+            std::unique(
+                sorted.begin(), sorted.end(), [](auto const & lhs, auto const & rhs) { return lhs.value == rhs.value; }),
+            sorted.end());
+
+        auto first = sorted.front().value;
+        auto last = sorted.back().value;
+
+        auto span = valueDistance(last, first);
+
+        // A table indexed by value is used while at least half of its entries hold an item
+        if (span / 2ul >= sorted.size())
+        {
+            return ValueTable{ ValueLayout::Sparse, std::move(sorted) };
+        }
+
+        auto entries = std::vector<ValueEntry>();
+        entries.reserve(span + 1ul);
+
+        auto next = sorted.begin();
+        for (auto offset = 0ul; offset <= span; ++offset)
+        {
+            auto value = static_cast<std::int64_t>(static_cast<std::uint64_t>(first) + offset);
+            if (next->value == value)
+            {
+                entries.push_back(*next++);
+            }
+            else
+            {
+                entries.push_back(ValueEntry{ value, std::nullopt });
+            }
+        }
+
+        return ValueTable{ first == 0 ? ValueLayout::Dense : ValueLayout::OffsetDense, std::move(entries) };
+    }
+
+}  // namespace enumgen
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// How the values of an enum are laid out, which decides how generated code maps a value to its item
+    /// </summary>
+    enum class ValueLayout : std::uint8_t
+    {
+        /// <summary>
+        /// Values starting at zero with no more holes than values, looked up by indexing a table with the value
+        /// </summary>
+        Dense,
+
+        /// <summary>
+        /// As dense but starting elsewhere, looked up by indexing a table with the distance from the first value
+        /// </summary>
+        OffsetDense,
+
+        /// <summary>
+        /// Values spread too widely for a table indexed by value, looked up by binary search of the sorted values
+        /// </summary>
+        Sparse
+    };
+
+    /// <summary>
+    /// Names of the value layouts as rendered for templates, indexed by ValueLayout
+    /// </summary>
+    inline constexpr auto valueLayoutNames = std::array<std::string_view, 3ul>{ "dense", "offsetDense", "sparse" };
+
+    /// <summary>
+    /// Entry of a value table, holes in a dense table have no item
+    /// </summary>
+    struct ValueEntry final
+    {
+        std::int64_t value;
+        std::optional<std::size_t> item;
+    };
+
+    /// <summary>
+    /// Lookup table from the values of an enum to its items
+    /// </summary>
+    struct ValueTable final
+    {
+        ValueLayout layout;
+
+        /// <summary>
+        /// Entries in order of value. Dense layouts have an entry for every value from the smallest to the largest,
+        /// the sparse layout has an entry for each distinct value. Where items share a value the first item is used
+        /// </summary>
+        std::vector<ValueEntry> entries;
+    };
+
+
+    /// <summary>
+    /// Distance from min up to value, computed unsigned so it cannot overflow between the extremes of a 64 bit range
+    /// </summary>
+    [[nodiscard]] constexpr std::uint64_t valueDistance(std::int64_t value, std::int64_t min) noexcept
+    {
+        return static_cast<std::uint64_t>(value) - static_cast<std::uint64_t>(min);
+    }
+
+    /// <summary>
+    /// Classifies the values of the items of an enum and builds the table for its layout, values must not be empty
+    /// </summary>
+    [[nodiscard]] ValueTable buildValueTable(std::span<std::int64_t const> values);
+
+}  // namespace enumgen
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <array>
+#include <charconv>
+#include <cstddef>
 #include <optional>
 #include <string_view>
 #include <tuple>
@@ -107,6 +109,25 @@ namespace enumgen
         }
     };
 
+    template <>
+    struct ConvertValue<std::size_t>
+    {
+        using value_type = std::size_t;
+
+        [[nodiscard]] static std::optional<value_type> tryConvert(std::string_view value) noexcept
+        {
+            auto result = value_type{};
+            auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), result);
+
+            if (error != std::errc{} || end != value.data() + value.size())
+            {
+                return std::nullopt;
+            }
+
+            return result;
+        }
+    };
+
 
     /// <summary>
     /// Contains details needed to parse a command line argument matching a parameter into a command instance
@@ -0,0 +1,305 @@
+#include <enumgen/utils/Files.hpp>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#if defined(_WIN32)
+    #define NOMINMAX
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+
+using namespace std::filesystem;
+
+
+namespace enumgen
+{
+    namespace
+    {
+
+        std::string readFile(path const & file)
+        {
+            auto stream = std::ifstream(file, std::ios::in | std::ios::binary);
+            if (!stream)
+            {
+                throw std::runtime_error(fmt::format("Unable to read file '{}'", file));
+            }
+
+            auto result = std::string(file_size(file), '\0');
+            stream.read(result.data(), static_cast<std::streamsize>(result.size()));
+            result.resize(static_cast<std::size_t>(stream.gcount()));
+            return result;
+        }
+
+#if defined(_WIN32)
+        void * mapFile(path const & file, std::size_t size)
+        {
+            auto fileHandle = CreateFileW(
+                file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (fileHandle == INVALID_HANDLE_VALUE)
+            {
+                return nullptr;
+            }
+
+            auto mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(fileHandle);
+            if (!mappingHandle)
+            {
+                return nullptr;
+            }
+
+            // The view keeps the mapping alive after the handle is closed
+            auto * view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, size);
+            CloseHandle(mappingHandle);
+            return view;
+        }
+
+        void unmapFile(void * mapping, std::size_t) noexcept
+        {
+            UnmapViewOfFile(mapping);
+        }
+#else
+        void * mapFile(path const & file, std::size_t size)
+        {
+            auto descriptor = ::open(file.c_str(), O_RDONLY);
+            if (descriptor == -1)
+            {
+                return nullptr;
+            }
+
+            // The mapping stays valid after the descriptor is closed
+            auto * view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            ::close(descriptor);
+            return view == MAP_FAILED ? nullptr : view;
+        }
+
+        void unmapFile(void * mapping, std::size_t size) noexcept
+        {
+            ::munmap(mapping, size);
+        }
+#endif
+
+        path temporaryFileFor(path const & file)
+        {
+            // Unique per process and thread so concurrent writers never share a temporary file
+            static auto counter = std::atomic<std::size_t>(0ul);
+
+            auto threadId = std::hash<std::thread::id>{}(std::this_thread::get_id());
+            auto suffix = fmt::format(".{:x}.{}.tmp", threadId, counter.fetch_add(1ul, std::memory_order_relaxed));
+
+            auto result = file;
+            result += suffix;
+            return result;
+        }
+
+    }  // namespace
+
+
+    void WriteStats::record(WriteResult result) noexcept
+    {
+        if (result == WriteResult::Written)
+        {
+            ++written;
+        }
+        else
+        {
+            ++unchanged;
+        }
+    }
+
+    WriteStats & WriteStats::operator+=(WriteStats const & other) noexcept
+    {
+        written += other.written;
+        unchanged += other.unchanged;
+        return *this;
+    }
+
+
+    MappedFile::MappedFile(path const & file)
+    {
+        auto error = std::error_code{};
+        auto size = file_size(file, error);
+        if (error)
+        {
+            throw std::runtime_error(fmt::format("Unable to read file '{}': {}", file, error.message()));
+        }
+
+        if (size >= mapThreshold)
+        {
+            mapping = mapFile(file, size);
+            if (mapping)
+            {
+                mappedSize = size;
+                return;
+            }
+        }
+
+        // Small files, and any file that cannot be mapped, are read instead
+        buffer = readFile(file);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        unmap();
+    }
+
+    MappedFile::MappedFile(MappedFile && other) noexcept
+      : buffer(std::move(other.buffer))
+      , mapping(std::exchange(other.mapping, nullptr))
+      , mappedSize(std::exchange(other.mappedSize, 0ul))
+    { }
+
+    MappedFile & MappedFile::operator=(MappedFile && other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+            buffer = std::move(other.buffer);
+            mapping = std::exchange(other.mapping, nullptr);
+            mappedSize = std::exchange(other.mappedSize, 0ul);
+        }
+
+        return *this;
+    }
+
+    std::string_view MappedFile::view() const noexcept
+    {
+        if (mapping)
+        {
+            return std::string_view(static_cast<char const *>(mapping), mappedSize);
+        }
+
+        return buffer;
+    }
+
+    bool MappedFile::mapped() const noexcept
+    {
+        return mapping != nullptr;
+    }
+
+    void MappedFile::unmap() noexcept
+    {
+        if (mapping)
+        {
+            unmapFile(mapping, mappedSize);
+            mapping = nullptr;
+            mappedSize = 0ul;
+        }
+    }
+
+
+    bool fileContentEquals(path const & file, std::string_view content) noexcept
+    {
+        auto error = std::error_code{};
+        auto size = file_size(file, error);
+        if (error || size != content.size())
+        {
+            return false;
+        }
+
+        auto stream = std::ifstream(file, std::ios::in | std::ios::binary);
+        if (!stream)
+        {
+            return false;
+        }
+
+        auto buffer = std::array<char, 64ul * 1024ul>{};
+        auto offset = 0ul;
+
+        while (offset < content.size())
+        {
+            auto count = std::min(buffer.size(), content.size() - offset);
+            if (!stream.read(buffer.data(), static_cast<std::streamsize>(count)))
+            {
+                return false;
+            }
+
+            if (std::memcmp(buffer.data(), content.data() + offset, count) != 0)
+            {
+                return false;
+            }
+
+            offset += count;
+        }
+
+        return true;
+    }
+
+
+    WriteResult writeIfChanged(path const & file, std::string_view content)
+    {
+        if (fileContentEquals(file, content))
+        {
+            return WriteResult::Unchanged;
+        }
+
+        auto temporaryFile = temporaryFileFor(file);
+
+        {
+            auto stream = std::ofstream(temporaryFile, std::ios::out | std::ios::binary | std::ios::trunc);
+            stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+            stream.close();
+
+            if (!stream)
+            {
+                auto error = std::error_code{};
+                remove(temporaryFile, error);
+                throw std::runtime_error(fmt::format("Unable to write file '{}'", temporaryFile));
+            }
+        }
+
+        auto error = std::error_code{};
+        rename(temporaryFile, file, error);
+        if (error)
+        {
+            auto ignored = std::error_code{};
+            remove(temporaryFile, ignored);
+            throw std::runtime_error(fmt::format("Unable to replace file '{}': {}", file, error.message()));
+        }
+
+        return WriteResult::Written;
+    }
+
+    bool isWithin(path const & file, path const & root) noexcept
+    {
+        auto relative = file.lexically_normal().lexically_relative(root.lexically_normal());
+        return !relative.empty() && *relative.begin() != ".." && *relative.begin() != ".";
+    }
+
+    bool removeFileAndEmptyParents(path const & file, path const & root)
+    {
+        if (!remove(file))
+        {
+            return false;
+        }
+
+        for (auto directory = file.parent_path(); isWithin(directory, root); directory = directory.parent_path())
+        {
+            if (!is_empty(directory))
+            {
+                break;
+            }
+
+            remove(directory);
+        }
+
+        return true;
+    }
+
+}  // namespace enumgen
\ No newline at end of file
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// Outcome of writing an output file
+    /// </summary>
+    enum class WriteResult
+    {
+        Written,
+        Unchanged
+    };
+
+
+    /// <summary>
+    /// Counts of output files written and left unchanged
+    /// </summary>
+    struct WriteStats final
+    {
+        std::size_t written = 0ul;
+        std::size_t unchanged = 0ul;
+
+        void record(WriteResult result) noexcept;
+
+        WriteStats & operator+=(WriteStats const & other) noexcept;
+    };
+
+
+    /// <summary>
+    /// Read only view of the contents of a file. Files at or above the mapping threshold are memory mapped so they can
+    /// be parsed in place, smaller files are read into memory where a single read is cheaper than setting up a mapping
+    /// </summary>
+    class MappedFile final
+    {
+    public:
+        /// <summary>
+        /// Files smaller than this are read rather than mapped
+        /// </summary>
+        static constexpr std::size_t mapThreshold = 64ul * 1024ul;
+
+    private:
+        std::string buffer;
+        void * mapping = nullptr;
+        std::size_t mappedSize = 0ul;
+
+    public:
+        /// <summary>
+        /// Opens the file, throws std::runtime_error if it cannot be read
+        /// </summary>
+        explicit MappedFile(std::filesystem::path const & file);
+        ~MappedFile();
+
+        MappedFile(MappedFile const &) = delete;
+        MappedFile(MappedFile && other) noexcept;
+        MappedFile & operator=(MappedFile const &) = delete;
+        MappedFile & operator=(MappedFile && other) noexcept;
+
+        /// <summary>
+        /// Returns the contents of the file, valid for the lifetime of this object
+        /// </summary>
+        [[nodiscard]] std::string_view view() const noexcept;
+
+        /// <summary>
+        /// Returns true if the contents are memory mapped rather than read
+        /// </summary>
+        [[nodiscard]] bool mapped() const noexcept;
+
+    private:
+        void unmap() noexcept;
+    };
+
+
+    /// <summary>
+    /// Returns true if the file exists and its contents are identical to the given content
+    /// </summary>
+    [[nodiscard]] bool fileContentEquals(std::filesystem::path const & file, std::string_view content) noexcept;
+
+
+    /// <summary>
+    /// Writes the content to the file only if it differs from the existing contents so the modification time of
+    /// unchanged files is preserved. The file is replaced atomically by writing to a temporary file and renaming it
+    /// </summary>
+    WriteResult writeIfChanged(std::filesystem::path const & file, std::string_view content);
+
+
+    /// <summary>
+    /// Returns true if the path lies inside the root directory, compared lexically without touching the filesystem
+    /// </summary>
+    [[nodiscard]] bool isWithin(std::filesystem::path const & file, std::filesystem::path const & root) noexcept;
+
+
+    /// <summary>
+    /// Removes the file along with any parent directories left empty by its removal, stopping at the root directory.
+    /// Returns false if the file did not exist
+    /// </summary>
+    bool removeFileAndEmptyParents(std::filesystem::path const & file, std::filesystem::path const & root);
+
+}  // namespace enumgen
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// 64 bit FNV-1a offset basis
+    /// </summary>
+    constexpr std::uint64_t fnv1aOffsetBasis = 14695981039346656037ull;
+
+    /// <summary>
+    /// 64 bit FNV-1a prime
+    /// </summary>
+    constexpr std::uint64_t fnv1aPrime = 1099511628211ull;
+
+
+    /// <summary>
+    /// Computes the 64 bit FNV-1a hash of the data
+    /// </summary>
+    [[nodiscard]] constexpr std::uint64_t fnv1a(std::string_view data, std::uint64_t seed = fnv1aOffsetBasis) noexcept
+    {
+        auto hash = seed;
+        for (auto c : data)
+        {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= fnv1aPrime;
+        }
+
+        return hash;
+    }
+
+
+    /// <summary>
+    /// Incrementally hashes a sequence of fields, each field is length prefixed so the boundaries between fields
+    /// contribute to the hash
+    /// </summary>
+    class Hasher final
+    {
+    private:
+        std::uint64_t state = fnv1aOffsetBasis;
+
+    public:
+        constexpr Hasher & update(std::uint64_t value) noexcept
+        {
+            for (auto byte = 0ul; byte < sizeof(value); ++byte)
+            {
+                state ^= (value >> (byte * 8ul)) & 0xfful;
+                state *= fnv1aPrime;
+            }
+
+            return *this;
+        }
+
+        constexpr Hasher & update(std::string_view data) noexcept
+        {
+            update(static_cast<std::uint64_t>(data.size()));
+            state = fnv1a(data, state);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr std::uint64_t digest() const noexcept
+        {
+            return state;
+        }
+    };
+
+}  // namespace enumgen
\ No newline at end of file
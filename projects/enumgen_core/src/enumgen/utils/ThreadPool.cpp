@@ -0,0 +1,164 @@
+#include <enumgen/utils/ThreadPool.hpp>
+
+#include <algorithm>
+#include <utility>
+
+
+namespace enumgen
+{
+
+    ThreadPool::ThreadPool(std::size_t workerCount)
+    {
+        workerCount = std::max<std::size_t>(workerCount, 1ul);
+
+        queues.reserve(workerCount);
+        for (auto index = 0ul; index < workerCount; ++index)
+        {
+            queues.emplace_back(std::make_unique<Queue>());
+        }
+
+        workers.reserve(workerCount);
+        for (auto index = 0ul; index < workerCount; ++index)
+        {
+            workers.emplace_back([this, index]() { run(index); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            auto lock = std::scoped_lock(stateMutex);
+            stopping = true;
+        }
+
+        taskQueued.notify_all();
+
+        for (auto & worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    std::size_t ThreadPool::size() const noexcept
+    {
+        return workers.size();
+    }
+
+    void ThreadPool::submit(task_type task)
+    {
+        // Tasks are dealt round-robin so every worker starts with local work, stealing rebalances from there. The task
+        // is counted before it is pushed so a worker taking it straight away cannot decrement the count below zero
+        auto queueIndex = 0ul;
+        {
+            auto lock = std::scoped_lock(stateMutex);
+            queueIndex = nextQueue;
+            nextQueue = (nextQueue + 1ul) % queues.size();
+            ++pendingCount;
+            ++queuedCount;
+        }
+
+        {
+            auto & queue = *queues[queueIndex];
+            auto lock = std::scoped_lock(queue.mutex);
+            queue.tasks.emplace_back(std::move(task));
+        }
+
+        taskQueued.notify_one();
+    }
+
+    void ThreadPool::wait()
+    {
+        auto lock = std::unique_lock(stateMutex);
+        tasksDone.wait(lock, [this]() { return pendingCount == 0ul; });
+
+        if (firstException)
+        {
+            std::rethrow_exception(std::exchange(firstException, nullptr));
+        }
+    }
+
+    void ThreadPool::run(std::size_t workerIndex) noexcept
+    {
+        while (true)
+        {
+            {
+                auto lock = std::unique_lock(stateMutex);
+                taskQueued.wait(lock, [this]() { return stopping || queuedCount != 0ul; });
+
+                if (stopping && queuedCount == 0ul)
+                {
+                    return;
+                }
+            }
+
+            auto task = task_type{};
+            if (!tryTake(workerIndex, task))
+            {
+                // Another worker claimed the task between the wake up and the queue scan
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::exception_ptr exception;
+            try
+            {
+                task(workerIndex);
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+
+            auto lock = std::scoped_lock(stateMutex);
+            if (exception && !firstException)
+            {
+                firstException = std::move(exception);
+            }
+
+            if (--pendingCount == 0ul)
+            {
+                tasksDone.notify_all();
+            }
+        }
+    }
+
+    bool ThreadPool::tryTake(std::size_t workerIndex, task_type & task) noexcept
+    {
+        auto claim = [&](Queue & queue, bool fromBack) -> bool {
+            auto lock = std::scoped_lock(queue.mutex);
+            if (queue.tasks.empty())
+            {
+                return false;
+            }
+
+            if (fromBack)
+            {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            else
+            {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+
+            return true;
+        };
+
+        // Own queue is used LIFO while steals are FIFO from the other end to keep contention on a queue low
+        auto claimed = claim(*queues[workerIndex], true);
+        for (auto offset = 1ul; !claimed && offset < queues.size(); ++offset)
+        {
+            claimed = claim(*queues[(workerIndex + offset) % queues.size()], false);
+        }
+
+        if (claimed)
+        {
+            auto lock = std::scoped_lock(stateMutex);
+            --queuedCount;
+        }
+
+        return claimed;
+    }
+
+}  // namespace enumgen
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace enumgen
+{
+
+    /// <summary>
+    /// Fixed size pool of worker threads, each with its own task queue. Idle workers steal queued tasks from the other
+    /// workers so uneven task costs are balanced across the pool
+    /// </summary>
+    class ThreadPool final
+    {
+    public:
+        /// <summary>
+        /// Task executed on a worker, receives the index of the worker in the range [0, size())
+        /// </summary>
+        using task_type = std::function<void(std::size_t)>;
+
+    private:
+        struct Queue final
+        {
+            std::mutex mutex;
+            std::deque<task_type> tasks;
+        };
+
+        std::vector<std::unique_ptr<Queue>> queues;
+        std::vector<std::thread> workers;
+
+        std::mutex stateMutex;
+        std::condition_variable taskQueued;
+        std::condition_variable tasksDone;
+        std::size_t queuedCount = 0ul;
+        std::size_t pendingCount = 0ul;
+        std::size_t nextQueue = 0ul;
+        std::exception_ptr firstException;
+        bool stopping = false;
+
+    public:
+        explicit ThreadPool(std::size_t workerCount);
+        ~ThreadPool();
+
+        ThreadPool(ThreadPool const &) = delete;
+        ThreadPool(ThreadPool &&) = delete;
+        ThreadPool & operator=(ThreadPool const &) = delete;
+        ThreadPool & operator=(ThreadPool &&) = delete;
+
+        /// <summary>
+        /// Returns the number of worker threads
+        /// </summary>
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /// <summary>
+        /// Queues a task to run on one of the workers
+        /// </summary>
+        void submit(task_type task);
+
+        /// <summary>
+        /// Blocks until all submitted tasks have completed, rethrows the first exception thrown by a task
+        /// </summary>
+        void wait();
+
+    private:
+        void run(std::size_t workerIndex) noexcept;
+
+        [[nodiscard]] bool tryTake(std::size_t workerIndex, task_type & task) noexcept;
+    };
+
+}  // namespace enumgen
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+
+namespace enumgen::benchmarks
+{
+
+    /// <summary>
+    /// Prevents the compiler from optimizing away a value computed by a benchmark
+    /// </summary>
+    template <typename T>
+    void doNotOptimize(T const & value) noexcept
+    {
+#if defined(_MSC_VER)
+        static_cast<void>(static_cast<T const volatile &>(value));
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+
+    /// <summary>
+    /// Runs the function for the given number of repetitions after one warm up run, and prints the fastest and mean
+    /// time of a repetition
+    /// </summary>
+    template <typename Function>
+    void measure(std::string_view name, std::size_t repetitions, Function && function)
+    {
+        using clock = std::chrono::steady_clock;
+        using milliseconds = std::chrono::duration<double, std::milli>;
+
+        function();
+
+        auto fastest = milliseconds::max();
+        auto total = milliseconds::zero();
+
+        for (auto repetition = 0ul; repetition < repetitions; ++repetition)
+        {
+            auto start = clock::now();
+            function();
+            auto elapsed = milliseconds(clock::now() - start);
+
+            fastest = std::min(fastest, elapsed);
+            total += elapsed;
+        }
+
+        fmt::print(
+            "{:<48} fastest {:>10.3f} ms    mean {:>10.3f} ms\n",
+            name,
+            fastest.count(),
+            total.count() / static_cast<double>(std::max<std::size_t>(repetitions, 1ul)));
+    }
+
+}  // namespace enumgen::benchmarks
\ No newline at end of file
@@ -0,0 +1,268 @@
+#include <enumgen/benchmarks/LegacyValidation.hpp>
+
+#include <fmt/format.h>
+
+#include <array>
+#include <functional>
+
+
+using namespace fmt::literals;
+using namespace nlohmann;
+using namespace std::string_view_literals;
+
+
+namespace enumgen::benchmarks::legacy
+{
+    namespace
+    {
+
+        static constexpr std::string_view enumsField = "enums"sv;
+
+        static constexpr std::string_view nameField = "name"sv;
+        static constexpr std::string_view descriptionField = "description"sv;
+        static constexpr std::string_view headerPathField = "headerPath"sv;
+        static constexpr std::string_view codePathField = "codePath"sv;
+        static constexpr std::string_view includePathField = "includePath"sv;
+        static constexpr std::string_view namespaceField = "namespace"sv;
+        static constexpr std::string_view underlyingTypeField = "underlyingType"sv;
+        static constexpr std::string_view defaultField = "default"sv;
+
+        static constexpr std::string_view itemsArray = "items"sv;
+        static constexpr std::string_view itemNameField = "name"sv;
+        static constexpr std::string_view itemValueField = "value"sv;
+        static constexpr std::string_view itemStringField = "string"sv;
+        static constexpr std::string_view itemAltsArray = "alts"sv;
+
+        struct requirement final
+        {
+            std::function<bool(json const &)> check;
+            std::string errorMessage;
+        };
+
+        using errors = std::vector<std::string>;
+        using requirements = std::vector<requirement>;
+
+        bool required(
+            json const & node,
+            std::string_view name,
+            std::string_view field,
+            std::string missingMessage,
+            requirements requirements,
+            errors & errors) noexcept
+        {
+            if (!node.contains(field))
+            {
+                errors.emplace_back(
+                    fmt::vformat(missingMessage, fmt::make_format_args("name"_a = name, "field"_a = field)));
+                return false;
+            }
+
+            auto const & value = node[field];
+            for (auto const & requirement : requirements)
+            {
+                if (!requirement.check(value))
+                {
+                    errors.emplace_back(fmt::vformat(
+                        requirement.errorMessage,
+                        fmt::make_format_args("name"_a = name, "field"_a = field)));
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool optional(
+            json const & node,
+            std::string_view name,
+            std::string_view field,
+            requirements requirements,
+            errors & errors) noexcept
+        {
+            if (!node.contains(field))
+            {
+                return true;
+            }
+
+            auto success = true;
+            auto const & value = node[field];
+            for (auto const & requirement : requirements)
+            {
+                if (!requirement.check(value))
+                {
+                    errors.emplace_back(fmt::vformat(
+                        requirement.errorMessage,
+                        fmt::make_format_args("name"_a = name, "field"_a = field)));
+                    success = false;
+                }
+            }
+
+            return success;
+        }
+
+        bool stringNotEmpty(json const & node) noexcept
+        {
+            auto value = node.get<std::string_view>();
+            return !value.empty() && value.size() != 0ul;
+        }
+
+        bool allItemsStrings(json const & node) noexcept
+        {
+            for (auto const & item : node)
+            {
+                if (!item.is_string())
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        void validateItem(std::string_view enumName, json const & node, errors & errors) noexcept
+        {
+            auto hasItemName = required(
+                node,
+                enumName,
+                itemNameField,
+                "Enum '{name}' has item with missing '{field}' field",
+                requirements{ requirement{ &json::is_string, "Enum '{name}' item has non-string '{field}' field" },
+                              requirement{ stringNotEmpty, "Enum '{name}' item has empty string '{field}' field" } },
+                errors);
+
+            if (!hasItemName)
+            {
+                return;
+            }
+
+            auto name = fmt::format("{}::{}", enumName, node[nameField].get<std::string_view>());
+
+            required(
+                node,
+                name,
+                itemStringField,
+                "Enum item '{name}' is missing '{field}' field",
+                requirements{ requirement{ &json::is_string, "Enum item '{name}::{field}' has non-string value" },
+                              requirement{ stringNotEmpty, "Enum item '{name}::{field}' has empty string value" } },
+                errors);
+
+            optional(
+                node,
+                name,
+                itemValueField,
+                requirements{
+                    requirement{ &json::is_number_integer, "Enum item '{name}::{field}' has non-int value" } },
+                errors);
+
+            optional(
+                node,
+                name,
+                itemAltsArray,
+                requirements{ requirement{ &json::is_array, "Enum item '{name}::{field}' has non-array value" },
+                              requirement{ allItemsStrings, "Enum item '{name}::{field}' has non-string values" } },
+                errors);
+        }
+
+        void validateEnum(json const & node, errors & errors) noexcept
+        {
+            auto hasName = required(
+                node,
+                ""sv,
+                nameField,
+                "Enum description is missing required '{field}' field",
+                requirements{ requirement{ &json::is_string, "Enum description has non-string '{field}' field" },
+                              requirement{ stringNotEmpty, "Enum description has empty '{field}' field" } },
+                errors);
+
+            if (!hasName)
+            {
+                return;
+            }
+
+            auto name = node[nameField].get<std::string_view>();
+
+            constexpr auto requiredFields
+                = std::array{ headerPathField, codePathField, includePathField, namespaceField };
+
+            for (auto const & field : requiredFields)
+            {
+                required(
+                    node,
+                    name,
+                    field,
+                    "Enum '{name}' is missing required '{field}' field",
+                    requirements{ requirement{ &json::is_string, "Enum '{name}::{field}' should hold a string" },
+                                  requirement{ stringNotEmpty, "Enum '{name}::{field}' cannot be empty" } },
+                    errors);
+            }
+
+            constexpr auto optionalFields = std::array{ descriptionField, underlyingTypeField, defaultField };
+
+            for (auto const & field : optionalFields)
+            {
+                optional(
+                    node,
+                    name,
+                    field,
+                    requirements{ requirement{ &json::is_string, "Enum '{name}::{field}' should hold a string" },
+                                  requirement{ stringNotEmpty, "Enum '{name}::{field}' cannot be empty" } },
+                    errors);
+            }
+
+            auto hasItems = required(
+                node,
+                name,
+                itemsArray,
+                "Enum '{name}' is missing required '{field}' field",
+                requirements{ requirement{ &json::is_array, "Enum '{name}::field}' is not an array" } },
+                errors);
+
+            if (!hasItems)
+            {
+                return;
+            }
+
+            for (auto const & item : node[itemsArray])
+            {
+                validateItem(name, item, errors);
+            }
+        }
+
+        errors validateEnums(json const & node) noexcept
+        {
+            errors errors;
+
+            auto hasEnums = required(
+                node,
+                "",
+                enumsField,
+                "'{field}' root node is missing",
+                requirements{ requirement{
+                    &json::is_array,
+                    "'{field}' should contain an array of enum descriptions",
+                } },
+                errors);
+
+            if (!hasEnums)
+            {
+                return errors;
+            }
+
+            for (auto const & description : node[enumsField])
+            {
+                validateEnum(description, errors);
+            }
+
+            return errors;
+        }
+
+
+    }  // namespace
+
+
+    std::vector<std::string> validateSpecification(json const & node) noexcept
+    {
+        return validateEnums(node);
+    }
+
+}  // namespace enumgen::benchmarks::legacy
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <string>
+#include <vector>
+
+
+namespace enumgen::benchmarks::legacy
+{
+
+    /// <summary>
+    /// Specification validator as it was before the table driven schema in enumgen/Validation, kept unchanged as the
+    /// baseline for the validation benchmarks
+    /// </summary>
+    [[nodiscard]] std::vector<std::string> validateSpecification(nlohmann::json const & node) noexcept;
+
+}  // namespace enumgen::benchmarks::legacy
\ No newline at end of file
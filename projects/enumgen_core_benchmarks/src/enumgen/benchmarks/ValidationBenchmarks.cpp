@@ -0,0 +1,70 @@
+#include <enumgen/Validation.hpp>
+#include <enumgen/benchmarks/Benchmark.hpp>
+#include <enumgen/benchmarks/LegacyValidation.hpp>
+#include <enumgen/benchmarks/ValidationBenchmarks.hpp>
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+
+
+using namespace nlohmann;
+
+
+namespace enumgen::benchmarks
+{
+    namespace
+    {
+
+        json makeSpecification(std::size_t enumCount, std::size_t itemCount)
+        {
+            auto enums = json::array();
+
+            for (auto enumIndex = 0ul; enumIndex < enumCount; ++enumIndex)
+            {
+                auto items = json::array();
+                for (auto itemIndex = 0ul; itemIndex < itemCount; ++itemIndex)
+                {
+                    items.push_back(json{ { "name", fmt::format("Item{}", itemIndex) },
+                                          { "string", fmt::format("item{}", itemIndex) },
+                                          { "value", itemIndex },
+                                          { "alts", json::array({ fmt::format("i{}", itemIndex) }) } });
+                }
+
+                enums.push_back(json{ { "name", fmt::format("Enum{}", enumIndex) },
+                                      { "description", "Benchmark enum" },
+                                      { "headerPath", "include/benchmark" },
+                                      { "codePath", "src/benchmark" },
+                                      { "includePath", "benchmark" },
+                                      { "namespace", "benchmark" },
+                                      { "underlyingType", "int" },
+                                      { "items", std::move(items) } });
+            }
+
+            return json{ { "enums", std::move(enums) } };
+        }
+
+    }  // namespace
+
+
+    void runValidationBenchmarks()
+    {
+        constexpr auto enumCount = 1000ul;
+        constexpr auto itemCount = 100ul;
+        constexpr auto repetitions = 10ul;
+
+        auto specification = makeSpecification(enumCount, itemCount);
+
+        fmt::print("Validation: {} enums with {} items each\n", enumCount, itemCount);
+
+        measure("validation/legacy", repetitions, [&]() {
+            doNotOptimize(legacy::validateSpecification(specification).size());
+        });
+
+        measure("validation/schema", repetitions, [&]() {
+            doNotOptimize(validateSpecification(specification).size());
+        });
+    }
+
+}  // namespace enumgen::benchmarks
\ No newline at end of file
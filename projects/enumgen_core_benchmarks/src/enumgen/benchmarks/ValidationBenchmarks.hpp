@@ -0,0 +1,12 @@
+#pragma once
+
+
+namespace enumgen::benchmarks
+{
+
+    /// <summary>
+    /// Compares the table driven specification validator against the legacy validator
+    /// </summary>
+    void runValidationBenchmarks();
+
+}  // namespace enumgen::benchmarks
\ No newline at end of file
@@ -0,0 +1,9 @@
+#include <enumgen/benchmarks/ValidationBenchmarks.hpp>
+
+
+int main()
+{
+    enumgen::benchmarks::runValidationBenchmarks();
+
+    return 0;
+}
\ No newline at end of file
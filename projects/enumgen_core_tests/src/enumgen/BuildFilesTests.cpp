@@ -0,0 +1,96 @@
+#include <enumgen/BuildFiles.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <filesystem>
+#include <tuple>
+
+
+using namespace std::filesystem;
+
+
+namespace enumgen::tests
+{
+
+    TEST(BuildFilesTests, formatDepfile_ListsTargetsThenDependencies)
+    {
+        // Arrange
+        auto targets = std::array{ path("out/Verbosity.h"), path("out/Verbosity.cpp") };
+        auto dependencies = std::array{ path("enums.json"), path("config.json") };
+
+        // Act
+        auto result = formatDepfile(targets, dependencies);
+
+        // Assert
+        EXPECT_EQ(result, "out/Verbosity.h \\\n out/Verbosity.cpp: \\\n  enums.json \\\n  config.json\n");
+    }
+
+    TEST(BuildFilesTests, formatDepfile_EscapesSpecialCharacters)
+    {
+        // Arrange
+        auto targets = std::array{ path("my out/Verbosity.h") };
+        auto dependencies = std::array{ path("#enums$.json") };
+
+        // Act
+        auto result = formatDepfile(targets, dependencies);
+
+        // Assert
+        EXPECT_EQ(result, "my\\ out/Verbosity.h: \\\n  \\#enums$$.json\n");
+    }
+
+    TEST(BuildFilesTests, staleOutputs_ReturnsPreviousOutputsNotGenerated)
+    {
+        // Arrange
+        auto previous = std::array{ path("out/Verbosity.h"), path("out/Level.h"), path("out/./Colour.h") };
+        auto current = std::array{ path("out/Colour.h"), path("out/Verbosity.h") };
+
+        // Act
+        auto result = staleOutputs(previous, current);
+
+        // Assert
+        ASSERT_EQ(result.size(), 1ul);
+        EXPECT_EQ(result.front(), path("out/Level.h"));
+    }
+
+    TEST(BuildFilesTests, readOutputList_ReadsWrittenList)
+    {
+        // Arrange
+        auto listFile = temp_directory_path() / "enumgen_build_files_tests.manifest";
+        auto outputs = std::array{ path("out/Verbosity.h"), path("out/Verbosity.cpp") };
+        std::ignore = writeOutputList(listFile, outputs);
+
+        // Act
+        auto result = readOutputList(listFile);
+        remove(listFile);
+
+        // Assert
+        ASSERT_EQ(result.size(), 2ul);
+        EXPECT_EQ(result[0], outputs[0]);
+        EXPECT_EQ(result[1], outputs[1]);
+    }
+
+    TEST(BuildFilesTests, readOutputList_WhenFileMissing_ReturnsEmpty)
+    {
+        // Act & Assert
+        EXPECT_TRUE(readOutputList(temp_directory_path() / "enumgen_missing.manifest").empty());
+    }
+
+    TEST(BuildFilesTests, formatSourcesInclude_SetsHeadersAndSources)
+    {
+        // Arrange
+        auto headerFiles = std::array{ path("out/include/Verbosity.h") };
+        auto codeFiles = std::array{ path("out/src/Verbosity.cpp"), path("out/src/$Level;.cpp") };
+
+        // Act
+        auto result = formatSourcesInclude(headerFiles, codeFiles);
+
+        // Assert
+        EXPECT_EQ(
+            result,
+            "# Generated by enumgen, do not edit\n\n"
+            "set(ENUMGEN_HEADERS\n    \"out/include/Verbosity.h\"\n)\n\n"
+            "set(ENUMGEN_SOURCES\n    \"out/src/Verbosity.cpp\"\n    \"out/src/\\$Level\\;.cpp\"\n)\n");
+    }
+
+}  // namespace enumgen::tests
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include <enumgen/Fingerprints.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+
+using namespace std::filesystem;
+
+
+namespace enumgen::tests
+{
+    namespace
+    {
+
+        class FingerprintCacheTests : public ::testing::Test
+        {
+        protected:
+            path directory;
+            path cacheFile;
+
+            void SetUp() override
+            {
+                directory = temp_directory_path() / "enumgen_fingerprint_tests";
+                remove_all(directory);
+                create_directories(directory);
+
+                cacheFile = directory / FingerprintCache::fileName;
+            }
+
+            void TearDown() override
+            {
+                remove_all(directory);
+            }
+        };
+
+    }  // namespace
+
+
+    TEST_F(FingerprintCacheTests, load_WhenFileMissing_IsEmpty)
+    {
+        // Act
+        auto cache = FingerprintCache::load(cacheFile);
+
+        // Assert
+        EXPECT_FALSE(cache.matches("Verbosity.h", 1ul));
+    }
+
+    TEST_F(FingerprintCacheTests, load_WhenFileCorrupt_IsEmpty)
+    {
+        // Arrange
+        std::ofstream(cacheFile) << "{ not json";
+
+        // Act
+        auto cache = FingerprintCache::load(cacheFile);
+
+        // Assert
+        EXPECT_FALSE(cache.matches("Verbosity.h", 1ul));
+    }
+
+    TEST_F(FingerprintCacheTests, save_RoundTripsRecordedFingerprints)
+    {
+        // Arrange
+        auto cache = FingerprintCache{};
+        cache.record("Verbosity.h", 0x0123456789abcdefull);
+        cache.record("Color.h", 42ul);
+
+        // Act
+        cache.save(cacheFile);
+        auto loaded = FingerprintCache::load(cacheFile);
+
+        // Assert
+        EXPECT_TRUE(loaded.matches("Verbosity.h", 0x0123456789abcdefull));
+        EXPECT_TRUE(loaded.matches("Color.h", 42ul));
+        EXPECT_FALSE(loaded.matches("Color.h", 43ul));
+    }
+
+    TEST_F(FingerprintCacheTests, save_DropsEntriesNotRecordedInRun)
+    {
+        // Arrange
+        auto first = FingerprintCache{};
+        first.record("Verbosity.h", 1ul);
+        first.record("Color.h", 2ul);
+        first.save(cacheFile);
+
+        auto second = FingerprintCache::load(cacheFile);
+        second.record("Verbosity.h", 1ul);
+
+        // Act
+        second.save(cacheFile);
+        auto loaded = FingerprintCache::load(cacheFile);
+
+        // Assert
+        EXPECT_TRUE(loaded.matches("Verbosity.h", 1ul));
+        EXPECT_FALSE(loaded.matches("Color.h", 2ul));
+    }
+
+    TEST_F(FingerprintCacheTests, save_WhenUnchanged_DoesNotRewrite)
+    {
+        // Arrange
+        auto cache = FingerprintCache{};
+        cache.record("Verbosity.h", 1ul);
+        cache.save(cacheFile);
+
+        // Act
+        auto result = cache.save(cacheFile);
+
+        // Assert
+        EXPECT_EQ(result, WriteResult::Unchanged);
+    }
+
+}  // namespace enumgen::tests
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include <enumgen/Specification.hpp>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+using namespace nlohmann;
+
+
+namespace enumgen::tests
+{
+    namespace
+    {
+
+        struct StreamedEnum final
+        {
+            json rootFields;
+            json description;
+        };
+
+        std::vector<StreamedEnum> streamAll(std::string const & text, json * rootFields = nullptr)
+        {
+            auto result = std::vector<StreamedEnum>();
+
+            auto fields = streamSpecification(text, [&](json const & root, json && description) {
+                result.emplace_back(StreamedEnum{ root, std::move(description) });
+            });
+
+            if (rootFields)
+            {
+                *rootFields = std::move(fields);
+            }
+
+            return result;
+        }
+
+    }  // namespace
+
+
+    TEST(SpecificationTests, streamSpecification_PassesEachEnumInOrder)
+    {
+        // Arrange
+        auto text = R"({
+            "headerRoot": "include",
+            "enums": [
+                { "name": "Verbosity", "items": [ { "name": "Quiet", "alts": [ "q", "quiet" ] } ] },
+                { "name": "Level", "items": [] }
+            ]
+        })";
+
+        // Act
+        auto result = streamAll(text);
+
+        // Assert
+        ASSERT_EQ(result.size(), 2ul);
+        EXPECT_EQ(
+            result[0].description,
+            json::parse(R"({ "name": "Verbosity", "items": [ { "name": "Quiet", "alts": [ "q", "quiet" ] } ] })"));
+        EXPECT_EQ(result[1].description, json::parse(R"({ "name": "Level", "items": [] })"));
+        EXPECT_EQ(result[0].rootFields, json::parse(R"({ "headerRoot": "include" })"));
+    }
+
+    TEST(SpecificationTests, streamSpecification_ReturnsRootFields)
+    {
+        // Arrange
+        auto text = R"({ "codeRoot": "src", "meta": { "owner": [ 1, 2 ] }, "enums": [], "trailing": null })";
+        auto rootFields = json();
+
+        // Act
+        auto result = streamAll(text, &rootFields);
+
+        // Assert
+        EXPECT_TRUE(result.empty());
+        EXPECT_EQ(
+            rootFields, json::parse(R"({ "codeRoot": "src", "meta": { "owner": [ 1, 2 ] }, "trailing": null })"));
+    }
+
+    TEST(SpecificationTests, streamSpecification_PassesNonObjectEnumsForValidation)
+    {
+        // Act
+        auto result = streamAll(R"({ "enums": [ "Verbosity", [] ] })");
+
+        // Assert
+        ASSERT_EQ(result.size(), 2ul);
+        EXPECT_EQ(result[0].description, json("Verbosity"));
+        EXPECT_EQ(result[1].description, json::array());
+    }
+
+    TEST(SpecificationTests, streamSpecification_WhenOutputRootFollowsEnums_Throws)
+    {
+        // Act & Assert
+        EXPECT_THROW(streamAll(R"({ "enums": [], "headerRoot": "include" })"), std::runtime_error);
+    }
+
+    TEST(SpecificationTests, streamSpecification_WhenEnumsMissing_Throws)
+    {
+        // Act & Assert
+        EXPECT_THROW(streamAll(R"({ "headerRoot": "include" })"), std::runtime_error);
+    }
+
+    TEST(SpecificationTests, streamSpecification_WhenEnumsNotArray_Throws)
+    {
+        // Act & Assert
+        EXPECT_THROW(streamAll(R"({ "enums": { "name": "Verbosity" } })"), std::runtime_error);
+        EXPECT_THROW(streamAll(R"({ "enums": "Verbosity" })"), std::runtime_error);
+    }
+
+    TEST(SpecificationTests, streamSpecification_WhenMalformed_Throws)
+    {
+        // Act & Assert
+        EXPECT_THROW(streamAll(R"({ "enums": [ { "name": } ] })"), std::runtime_error);
+        EXPECT_THROW(streamAll(R"([ { "name": "Verbosity" } ])"), std::runtime_error);
+    }
+
+}  // namespace enumgen::tests
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include <enumgen/Templates.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <tuple>
+
+
+using namespace std::filesystem;
+
+
+namespace enumgen::tests
+{
+    namespace
+    {
+
+        class TemplateCacheTests : public ::testing::Test
+        {
+        protected:
+            path directory;
+            path templateFile;
+
+            void SetUp() override
+            {
+                directory = temp_directory_path() / "enumgen_template_cache_tests";
+                create_directories(directory);
+
+                templateFile = directory / "enum.h.inja";
+                writeTemplate("{{ enum.name }}");
+            }
+
+            void TearDown() override
+            {
+                remove_all(directory);
+            }
+
+            void writeTemplate(std::string_view content) const
+            {
+                auto file = std::ofstream(templateFile, std::ios::out | std::ios::trunc);
+                file << content;
+            }
+        };
+
+    }  // namespace
+
+
+    TEST_F(TemplateCacheTests, render_ParsesTemplateOnce)
+    {
+        // Arrange
+        auto cache = TemplateCache();
+        auto data = nlohmann::json{ { "enum", { { "name", "Verbosity" } } } };
+
+        // Act
+        std::ignore = cache.render(templateFile, data);
+        std::ignore = cache.render(templateFile, data);
+        std::ignore = cache.render(templateFile, data);
+
+        // Assert
+        EXPECT_EQ(cache.stats().parseCount, 1ul);
+        EXPECT_EQ(cache.stats().renderCount, 3ul);
+    }
+
+    TEST_F(TemplateCacheTests, render_WhenTemplateModified_ParsesAgain)
+    {
+        // Arrange
+        auto cache = TemplateCache();
+        auto data = nlohmann::json{ { "enum", { { "name", "Verbosity" } } } };
+        std::ignore = cache.render(templateFile, data);
+
+        // Act
+        writeTemplate("// {{ enum.name }}");
+        last_write_time(templateFile, last_write_time(templateFile) + std::chrono::seconds(1));
+        std::ignore = cache.render(templateFile, data);
+
+        // Assert
+        EXPECT_EQ(cache.stats().parseCount, 2ul);
+        EXPECT_EQ(cache.stats().renderCount, 2ul);
+    }
+
+    TEST_F(TemplateCacheTests, include_WhenTemplateUnchanged_ParsesTemplateOnce)
+    {
+        // Arrange
+        auto cache = TemplateCache();
+
+        // Act
+        cache.include("enum.h.inja", templateFile);
+        cache.include("enum.h.inja", templateFile);
+
+        // Assert
+        EXPECT_EQ(cache.stats().parseCount, 1ul);
+        EXPECT_EQ(cache.stats().renderCount, 0ul);
+    }
+
+    TEST_F(TemplateCacheTests, include_WhenTemplateModified_ParsesAgain)
+    {
+        // Arrange
+        auto cache = TemplateCache();
+        cache.include("enum.h.inja", templateFile);
+
+        // Act
+        writeTemplate("// {{ enum.name }}");
+        last_write_time(templateFile, last_write_time(templateFile) + std::chrono::seconds(1));
+        cache.include("enum.h.inja", templateFile);
+
+        // Assert
+        EXPECT_EQ(cache.stats().parseCount, 2ul);
+    }
+
+    TEST_F(TemplateCacheTests, get_WhenTemplateMissing_Throws)
+    {
+        // Arrange
+        auto cache = TemplateCache();
+
+        // Act & Assert
+        EXPECT_ANY_THROW(std::ignore = cache.get(directory / "missing.inja"));
+        EXPECT_EQ(cache.stats().parseCount, 0ul);
+    }
+
+}  // namespace enumgen::tests
\ No newline at end of file
@@ -0,0 +1,372 @@
+#include <enumgen/Validation.hpp>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <string>
+#include <vector>
+
+
+using namespace nlohmann;
+
+
+namespace enumgen::tests
+{
+    namespace
+    {
+
+        json validSpecification()
+        {
+            return json::parse(R"({
+                "enums": [
+                    {
+                        "name": "Verbosity",
+                        "headerPath": "include/example",
+                        "codePath": "src/example",
+                        "includePath": "example",
+                        "namespace": "example",
+                        "underlyingType": "int",
+                        "items": [
+                            { "name": "Quiet", "string": "quiet", "value": 0, "alts": [ "q" ] },
+                            { "name": "Loud", "string": "loud" }
+                        ]
+                    }
+                ]
+            })");
+        }
+
+    }  // namespace
+
+
+    TEST(ValidationTests, validateSpecification_WhenValid_ReturnsNoErrors)
+    {
+        // Act
+        auto errors = validateSpecification(validSpecification());
+
+        // Assert
+        EXPECT_TRUE(errors.empty());
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenEnumsMissing_ReturnsError)
+    {
+        // Act
+        auto errors = validateSpecification(json::object());
+
+        // Assert
+        EXPECT_EQ(errors, std::vector<std::string>{ "'enums' root node is missing" });
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenEnumsNotArray_ReturnsError)
+    {
+        // Act
+        auto errors = validateSpecification(json{ { "enums", "Verbosity" } });
+
+        // Assert
+        EXPECT_EQ(errors, std::vector<std::string>{ "'enums' should contain an array of enum descriptions" });
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenEnumNameMissing_SkipsOtherFields)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0].erase("name");
+        specification["enums"][0].erase("codePath");
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_EQ(errors, std::vector<std::string>{ "Enum description is missing required 'name' field" });
+    }
+
+    TEST(ValidationTests, validateSpecification_ReportsEveryInvalidEnumField)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0].erase("codePath");
+        specification["enums"][0]["namespace"] = "";
+        specification["enums"][0]["underlyingType"] = 4;
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        auto expected = std::vector<std::string>{ "Enum 'Verbosity' is missing required 'codePath' field",
+                                                  "Enum 'Verbosity::namespace' cannot be empty",
+                                                  "Enum 'Verbosity::underlyingType' should hold a string" };
+        EXPECT_EQ(errors, expected);
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenParseStrategyKnown_ReturnsNoErrors)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0]["parseStrategy"] = "switch";
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_TRUE(errors.empty());
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenParseStrategyUnknown_ReturnsError)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0]["parseStrategy"] = "trie";
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_EQ(
+            errors,
+            std::vector<std::string>{
+                "Enum 'Verbosity::parseStrategy' should be one of auto, hash, switch, linear" });
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenCaseInsensitiveNotBoolean_ReturnsError)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0]["caseInsensitive"] = "yes";
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_EQ(errors, std::vector<std::string>{ "Enum 'Verbosity::caseInsensitive' should hold a boolean" });
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenFlagsNotBoolean_ReturnsError)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0]["flags"] = 1;
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_EQ(errors, std::vector<std::string>{ "Enum 'Verbosity::flags' should hold a boolean" });
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenFlags_ReturnsNoErrors)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0]["flags"] = true;
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_TRUE(errors.empty());
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenFlagNegative_ReturnsError)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0]["flags"] = true;
+        specification["enums"][0]["items"][0]["value"] = -1;
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_EQ(
+            errors,
+            std::vector<std::string>{ "Enum item 'Verbosity::Quiet::value' should be a non-negative flag" });
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenImplicitFlagExceedsHighestBit_ReturnsError)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0]["flags"] = true;
+        specification["enums"][0]["items"][0]["value"] = 4611686018427387904ll;
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_EQ(
+            errors,
+            std::vector<std::string>{ "Enum item 'Verbosity::Loud' has no bit left for an implicit flag" });
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenFlagStringContainsSeparator_ReturnsError)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0]["flags"] = true;
+        specification["enums"][0]["items"][0]["alts"] = json::array({ "q|quiet" });
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_EQ(
+            errors,
+            std::vector<std::string>{ "Enum item 'Verbosity::Quiet' strings cannot contain the separator '|'" });
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenItemsNotArray_ReturnsError)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0]["items"] = json::object();
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_EQ(errors, std::vector<std::string>{ "Enum 'Verbosity::items' is not an array" });
+    }
+
+    TEST(ValidationTests, validateSpecification_ReportsInvalidItemFields)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        auto & items = specification["enums"][0]["items"];
+        items[0]["value"] = "zero";
+        items[0]["alts"] = json::array({ "q", 1 });
+        items[1].erase("string");
+        items.push_back(json{ { "string", "silent" } });
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        auto expected = std::vector<std::string>{ "Enum item 'Verbosity::Quiet::value' has non-int value",
+                                                  "Enum item 'Verbosity::Quiet::alts' has non-string values",
+                                                  "Enum item 'Verbosity::Loud' is missing 'string' field",
+                                                  "Enum 'Verbosity' has item with missing 'name' field" };
+        EXPECT_EQ(errors, expected);
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenItemNameRepeated_ReturnsError)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0]["items"][1]["name"] = "Quiet";
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_EQ(
+            errors, std::vector<std::string>{ "Enum item 'Verbosity::Quiet' has the same name as an earlier item" });
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenStringsParseToSeveralItems_ReturnsErrors)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        auto & items = specification["enums"][0]["items"];
+        items[1]["string"] = "quiet";
+        items.push_back(json{ { "name", "Silent" }, { "string", "silent" }, { "alts", json::array({ "q" }) } });
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        auto expected = std::vector<std::string>{
+            "Enum item 'Verbosity::Loud::string' already parses to another item",
+            "Enum item 'Verbosity::Silent::alts' holds a string that already parses to another item"
+        };
+        EXPECT_EQ(errors, expected);
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenCaseInsensitiveStringsDifferByCase_ReturnsError)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0]["caseInsensitive"] = true;
+        specification["enums"][0]["items"][1]["alts"] = json::array({ "Q" });
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_EQ(
+            errors,
+            std::vector<std::string>{
+                "Enum item 'Verbosity::Loud::alts' holds a string that already parses to another item" });
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenItemRepeatsOwnString_ReturnsNoErrors)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0]["items"][0]["alts"] = json::array({ "quiet", "q" });
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_TRUE(errors.empty());
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenValuesOverflowUnderlyingType_ReturnsErrors)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0]["underlyingType"] = "std::uint8_t";
+        specification["enums"][0]["items"][0]["value"] = 255;
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_EQ(
+            errors,
+            std::vector<std::string>{ "Enum item 'Verbosity::Loud::value' does not fit in the underlying type" });
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenUnderlyingTypeUnknown_LeavesRangeToCompiler)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0]["underlyingType"] = "example::Integer";
+        specification["enums"][0]["items"][0]["value"] = -1;
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_TRUE(errors.empty());
+    }
+
+    TEST(ValidationTests, validateSpecification_WhenValuesFitNoUnderlyingType_ReturnsError)
+    {
+        // Arrange
+        auto specification = validSpecification();
+        specification["enums"][0].erase("underlyingType");
+        specification["enums"][0]["items"][0]["value"] = 9223372036854775807ll;
+
+        // Act
+        auto errors = validateSpecification(specification);
+
+        // Assert
+        EXPECT_EQ(
+            errors, std::vector<std::string>{ "Enum 'Verbosity' has values that do not fit in any underlying type" });
+    }
+
+    TEST(ValidationTests, validateEnum_AppendsToExistingErrors)
+    {
+        // Arrange
+        auto errors = std::vector<std::string>{ "existing" };
+
+        // Act
+        validateEnum(json::object(), errors);
+
+        // Assert
+        auto expected
+            = std::vector<std::string>{ "existing", "Enum description is missing required 'name' field" };
+        EXPECT_EQ(errors, expected);
+    }
+
+}  // namespace enumgen::tests
\ No newline at end of file
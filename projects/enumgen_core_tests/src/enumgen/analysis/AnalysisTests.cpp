@@ -0,0 +1,566 @@
+#include <enumgen/analysis/Analysis.hpp>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+using namespace nlohmann;
+using namespace std::string_view_literals;
+
+
+namespace enumgen::tests
+{
+    namespace
+    {
+
+        json verbosityDescription(std::string_view parseStrategy = "auto")
+        {
+            auto description = json::parse(R"({
+                "name": "Verbosity",
+                "items": [
+                    { "name": "Quiet", "string": "Quiet", "alts": [ "quiet", "q" ] },
+                    { "name": "Normal", "string": "Normal", "alts": [ "quiet" ] },
+                    { "name": "Loud", "string": "Loud" }
+                ]
+            })");
+
+            description["parseStrategy"] = parseStrategy;
+            return description;
+        }
+
+    }  // namespace
+
+
+    TEST(AnalysisTests, escapeStringLiteral_WhenPlain_ReturnsUnchanged)
+    {
+        // Act & Assert
+        EXPECT_EQ(escapeStringLiteral("Verbosity 1"sv), "Verbosity 1");
+    }
+
+    TEST(AnalysisTests, escapeStringLiteral_EscapesQuotesBackslashesAndControlCharacters)
+    {
+        // Act
+        auto result = escapeStringLiteral("a\"b\\c\td\x01" "7"sv);
+
+        // Assert
+        EXPECT_EQ(result, R"(a\"b\\c\td\0017)");
+    }
+
+    TEST(AnalysisTests, analyzeEnum_ParseKeys_HoldStringsThenAltsOfEachItem)
+    {
+        // Act
+        auto analysis = analyzeEnum(verbosityDescription());
+
+        // Assert
+        auto strings = std::vector<std::string>();
+        for (auto const & key : analysis["parseKeys"])
+        {
+            strings.push_back(key["string"].get<std::string>());
+        }
+
+        EXPECT_EQ(strings, (std::vector<std::string>{ "Quiet", "quiet", "q", "Normal", "Loud" }));
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenStringRepeated_FirstItemWins)
+    {
+        // Act
+        auto analysis = analyzeEnum(verbosityDescription());
+
+        // Assert
+        for (auto const & key : analysis["parseKeys"])
+        {
+            if (key["string"] == "quiet")
+            {
+                EXPECT_EQ(key["item"], "Quiet");
+            }
+        }
+    }
+
+    TEST(AnalysisTests, foldAscii_LowersAsciiLettersOnly)
+    {
+        // Act & Assert
+        EXPECT_EQ(foldAscii("New@Order[Z]\xc3\x9c"sv), "new@order[z]\xc3\x9c");
+    }
+
+    TEST(AnalysisTests, chooseParseStrategy_WhenFewKeys_ChoosesLinear)
+    {
+        // Arrange
+        auto keys = std::vector{ "Quiet"sv, "Loud"sv };
+
+        // Act & Assert
+        EXPECT_EQ(chooseParseStrategy(keys), ParseStrategy::Linear);
+    }
+
+    TEST(AnalysisTests, chooseParseStrategy_WhenModerateKeys_ChoosesSwitch)
+    {
+        // Arrange
+        auto keys = std::vector{ "Quiet"sv, "Minimal"sv, "Normal"sv, "Detailed"sv, "Diagnostic"sv };
+
+        // Act & Assert
+        EXPECT_EQ(chooseParseStrategy(keys), ParseStrategy::Switch);
+    }
+
+    TEST(AnalysisTests, chooseParseStrategy_WhenManyKeys_ChoosesHashUnlessStringsAreLong)
+    {
+        // Arrange
+        auto shortStrings = std::vector<std::string>();
+        auto longStrings = std::vector<std::string>();
+        for (auto index = 0ul; index < 300ul; ++index)
+        {
+            shortStrings.push_back("V" + std::to_string(index));
+            longStrings.push_back("SomewhatLongerValue" + std::to_string(index));
+        }
+
+        auto shortKeys = std::vector<std::string_view>(shortStrings.begin(), shortStrings.end());
+        auto longKeys = std::vector<std::string_view>(longStrings.begin(), longStrings.end());
+
+        // Act
+        auto shortStrategy = chooseParseStrategy(shortKeys);
+        auto longStrategy = chooseParseStrategy(longKeys);
+
+        // Assert
+        EXPECT_EQ(shortStrategy, ParseStrategy::Hash);
+        EXPECT_EQ(longStrategy, ParseStrategy::Switch);
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenStrategySpecified_UsesIt)
+    {
+        for (auto strategy : { "hash"sv, "switch"sv, "linear"sv })
+        {
+            // Act
+            auto analysis = analyzeEnum(verbosityDescription(strategy));
+
+            // Assert
+            EXPECT_EQ(analysis["parseStrategy"], strategy);
+            EXPECT_EQ(analysis.contains("perfectHash"), strategy == "hash"sv);
+            EXPECT_EQ(analysis.contains("switchTree"), strategy == "switch"sv);
+        }
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenAuto_ResolvesStrategy)
+    {
+        // Act
+        auto analysis = analyzeEnum(verbosityDescription());
+
+        // Assert
+        EXPECT_EQ(analysis["parseStrategy"], "switch");
+    }
+
+    TEST(AnalysisTests, analyzeEnum_SwitchTree_LabelsLengthsAndCharacters)
+    {
+        // Act
+        auto analysis = analyzeEnum(verbosityDescription("switch"));
+
+        // Assert
+        auto const & nodes = analysis["switchTree"];
+        ASSERT_FALSE(nodes.empty());
+        EXPECT_EQ(nodes.front()["kind"], "switch");
+        EXPECT_FALSE(nodes.front().contains("position"));
+        EXPECT_EQ(nodes[1]["kind"], "case");
+        EXPECT_EQ(nodes[1]["label"], "1");
+
+        auto labels = std::vector<std::string>();
+        for (auto const & node : nodes)
+        {
+            if (node["kind"] == "case" && node["depth"] == 1)
+            {
+                labels.push_back(node["label"].get<std::string>());
+            }
+        }
+
+        // Quiet and quiet share length 5 and differ only in the first character
+        EXPECT_EQ(labels, (std::vector<std::string>{ "'Q'", "'q'" }));
+    }
+
+    TEST(AnalysisTests, analyzeEnum_PerfectHash_HasSlotForEveryParseKey)
+    {
+        // Act
+        auto analysis = analyzeEnum(verbosityDescription("hash"));
+
+        // Assert
+        auto const & perfectHash = analysis["perfectHash"];
+        EXPECT_EQ(perfectHash["tableSize"], analysis["parseKeys"].size());
+        EXPECT_EQ(perfectHash["slots"].size(), analysis["parseKeys"].size());
+        EXPECT_EQ(perfectHash["seeds"].size(), perfectHash["bucketCount"]);
+
+        for (auto const & slot : perfectHash["slots"])
+        {
+            EXPECT_TRUE(slot.contains("literal"));
+            EXPECT_TRUE(slot.contains("item"));
+        }
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenCaseInsensitive_FoldsKeysAndDropsCaseVariants)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["caseInsensitive"] = true;
+        description["items"][0]["alts"] = json::array({ "QUIET", "Shh" });
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        auto strings = std::vector<std::string>();
+        for (auto const & key : analysis["parseKeys"])
+        {
+            strings.push_back(key["string"].get<std::string>());
+        }
+
+        EXPECT_EQ(analysis["caseInsensitive"], true);
+        EXPECT_EQ(strings, (std::vector<std::string>{ "quiet", "shh", "normal", "loud" }));
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenCaseInsensitive_SwitchesOnFoldedCharacters)
+    {
+        // Arrange
+        auto description = json::parse(R"({
+            "name": "Side",
+            "parseStrategy": "switch",
+            "caseInsensitive": true,
+            "items": [
+                { "name": "Buy", "string": "Abc" },
+                { "name": "Sell", "string": "aBd" }
+            ]
+        })");
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        auto labels = std::vector<std::string>();
+        for (auto const & node : analysis["switchTree"])
+        {
+            if (node["kind"] == "case" && node["depth"] == 1)
+            {
+                labels.push_back(node["label"].get<std::string>());
+            }
+        }
+
+        // Folded keys only differ in the last character, the first characters differ by case alone
+        EXPECT_EQ(labels, (std::vector<std::string>{ "'c'", "'d'" }));
+    }
+
+    TEST(AnalysisTests, analyzeEnum_Values_FollowPreviousItemWhenOmitted)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["items"][0]["value"] = 4;
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        auto const & values = analysis["values"];
+        EXPECT_EQ(values["layout"], "offsetDense");
+        EXPECT_EQ(values["offsetItem"], "Quiet");
+        EXPECT_EQ(values["tableSize"], 3);
+        EXPECT_EQ(values["table"][2], (json{ { "value", 6 }, { "item", "Loud" } }));
+    }
+
+    TEST(AnalysisTests, analyzeEnum_Values_NameExtremesAndWhetherGapless)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["items"][0]["value"] = 2;
+        description["items"][1]["value"] = 0;
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        auto const & values = analysis["values"];
+        EXPECT_EQ(values["offsetItem"], "Normal");
+        EXPECT_EQ(values["maxItem"], "Quiet");
+        EXPECT_TRUE(values["gapless"]);
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenValuesHaveHoles_AreNotGapless)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["items"][2]["value"] = 3;
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        EXPECT_FALSE(analysis["values"]["gapless"]);
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenValueExceedsSignedRange_OmitsValues)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["items"][0]["value"] = 18446744073709551615ull;
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        EXPECT_FALSE(analysis.contains("values"));
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenValuesFollowItems_OrdinalsAreContiguous)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["items"][0]["value"] = -1;
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        EXPECT_TRUE(analysis["ordinals"]["contiguous"]);
+        EXPECT_EQ(analysis["ordinals"]["items"].size(), 3ul);
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenValuesShared_OrdinalOfFirstItemIsUsed)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["items"][1]["value"] = 0;
+        description["items"][2]["value"] = 5;
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        auto const & ordinals = analysis["ordinals"];
+        EXPECT_FALSE(ordinals["contiguous"]);
+        EXPECT_EQ(
+            ordinals["items"],
+            (json{ { { "item", "Quiet" }, { "ordinal", 0 } }, { { "item", "Loud" }, { "ordinal", 2 } } }));
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenFlags_TakesBitAboveHighestBitWhenOmitted)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["flags"] = true;
+        description["items"][1]["value"] = 6;
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        auto const & flags = analysis["flags"];
+        EXPECT_EQ(flags["items"][0], (json{ { "name", "Quiet" }, { "value", 1 } }));
+        EXPECT_EQ(flags["items"][1], (json{ { "name", "Normal" }, { "value", 6 } }));
+        EXPECT_EQ(flags["items"][2], (json{ { "name", "Loud" }, { "value", 8 } }));
+        EXPECT_EQ(flags["mask"], 15);
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenFlags_NamesSingleBitsAndSizesJoinedNames)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["flags"] = true;
+        description["items"][1]["value"] = 4;
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        auto const & flags = analysis["flags"];
+        EXPECT_EQ(flags["namedBits"], 13);
+        EXPECT_EQ(
+            flags["bits"],
+            (json{ { { "bit", 0 }, { "item", "Quiet" } },
+                   { { "bit", 1 } },
+                   { { "bit", 2 }, { "item", "Normal" } },
+                   { { "bit", 3 }, { "item", "Loud" } } }));
+        EXPECT_EQ(flags["maxStringSize"], "Quiet|Normal|Loud"sv.size());
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenNotFlags_OmitsFlags)
+    {
+        // Act
+        auto analysis = analyzeEnum(verbosityDescription());
+
+        // Assert
+        EXPECT_FALSE(analysis.contains("flags"));
+    }
+
+    TEST(AnalysisTests, analyzeEnum_BatchPrefixes_ReadFirstEightBytesOfEachKey)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["items"][2]["string"] = "Diagnostics";
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        auto const & prefixes = analysis["batchPrefixes"];
+        ASSERT_EQ(prefixes.size(), analysis["parseKeys"].size());
+        EXPECT_EQ(prefixes[2].get<std::uint64_t>(), std::uint64_t('q'));
+        EXPECT_EQ(prefixes[4].get<std::uint64_t>(), 0x74736f6e67616944ull);
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenManyKeys_OmitsBatchPrefixes)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        for (auto index = 0; index < 8; ++index)
+        {
+            description["items"].push_back({ { "name", "Item" }, { "string", "item" + std::to_string(index) } });
+        }
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        EXPECT_FALSE(analysis.contains("batchPrefixes"));
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenValuesInSmallRange_ChecksValidityWithBitmap)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["items"][0]["value"] = -2;
+        description["items"][1]["value"] = 100;
+        description["items"][2]["value"] = 3;
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        auto const & validity = analysis["validity"];
+        EXPECT_EQ(validity["layout"], "bitmap");
+        EXPECT_EQ(validity["bitCount"], 103);
+        ASSERT_EQ(validity["bitmap"].size(), 2ul);
+        EXPECT_EQ(validity["bitmap"][0].get<std::uint64_t>(), 0b100001ull);
+        EXPECT_EQ(validity["bitmap"][1].get<std::uint64_t>(), 1ull << 38u);
+        EXPECT_EQ(validity["sorted"], (json{ "Quiet", "Loud", "Normal" }));
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenValuesInWideRange_ChecksValidityBySortedValues)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["items"][0]["value"] = 1000000;
+        description["items"][2]["value"] = -1000000;
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        auto const & validity = analysis["validity"];
+        EXPECT_EQ(validity["layout"], "sorted");
+        EXPECT_FALSE(validity.contains("bitmap"));
+        EXPECT_EQ(validity["sorted"], (json{ "Loud", "Quiet", "Normal" }));
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenValuesFitTable_EncodesDistanceFromSmallestValue)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["items"][0]["value"] = 300;
+        description["items"][2]["value"] = 303;
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        auto const & encoding = analysis["encoding"];
+        EXPECT_EQ(encoding["mode"], "value");
+        EXPECT_EQ(encoding["codeBits"], 2);
+        EXPECT_EQ(encoding["codeType"], "std::uint8_t");
+        EXPECT_EQ(encoding["codeCount"], 4);
+        EXPECT_EQ(encoding["bitmap"], (json{ 0b1011 }));
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenValuesSparse_EncodesOrdinalOfFirstItemWithValue)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["items"][0]["value"] = 70000;
+        description["items"][1]["value"] = -5;
+        description["items"][2]["value"] = 70000;
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        auto const & encoding = analysis["encoding"];
+        EXPECT_EQ(encoding["mode"], "ordinal");
+        EXPECT_EQ(encoding["codeCount"], 3);
+        EXPECT_EQ(encoding["bitmap"], (json{ 0b011 }));
+        EXPECT_EQ(
+            encoding["sorted"],
+            (json{ { { "item", "Normal" }, { "ordinal", 1 } }, { { "item", "Quiet" }, { "ordinal", 0 } } }));
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenFlags_EncodesBitsWithoutBitmap)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["flags"] = true;
+        description["items"][2]["value"] = 512;
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        auto const & encoding = analysis["encoding"];
+        EXPECT_EQ(encoding["mode"], "flags");
+        EXPECT_EQ(encoding["codeBits"], 10);
+        EXPECT_EQ(encoding["codeType"], "std::uint16_t");
+        EXPECT_EQ(encoding["varintSize"], 2);
+        EXPECT_FALSE(encoding.contains("bitmap"));
+    }
+
+    TEST(AnalysisTests, resolveDescription_WritesValuesAndNarrowestUnderlyingType)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["items"][1]["value"] = 300;
+
+        // Act
+        resolveDescription(description);
+
+        // Assert
+        EXPECT_EQ(description["items"][0]["value"], 0);
+        EXPECT_EQ(description["items"][1]["value"], 300);
+        EXPECT_EQ(description["items"][2]["value"], 301);
+        EXPECT_EQ(description["underlyingType"], "std::uint16_t");
+    }
+
+    TEST(AnalysisTests, resolveDescription_WhenUnderlyingTypeGiven_KeepsIt)
+    {
+        // Arrange
+        auto description = verbosityDescription();
+        description["underlyingType"] = "int";
+
+        // Act
+        resolveDescription(description);
+
+        // Assert
+        EXPECT_EQ(description["underlyingType"], "int");
+    }
+
+    TEST(AnalysisTests, analyzeEnum_WhenNoItems_UsesLinear)
+    {
+        // Arrange
+        auto description = json::parse(R"({ "name": "Empty", "parseStrategy": "hash", "items": [] })");
+
+        // Act
+        auto analysis = analyzeEnum(description);
+
+        // Assert
+        EXPECT_EQ(analysis["parseStrategy"], "linear");
+        EXPECT_TRUE(analysis["parseKeys"].empty());
+        EXPECT_FALSE(analysis.contains("perfectHash"));
+        EXPECT_FALSE(analysis.contains("values"));
+        EXPECT_FALSE(analysis.contains("ordinals"));
+        EXPECT_FALSE(analysis.contains("validity"));
+        EXPECT_FALSE(analysis.contains("encoding"));
+        EXPECT_FALSE(analysis.contains("batchPrefixes"));
+    }
+
+}  // namespace enumgen::tests
\ No newline at end of file
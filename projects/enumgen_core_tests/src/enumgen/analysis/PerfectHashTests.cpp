@@ -0,0 +1,109 @@
+#include <enumgen/analysis/PerfectHash.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+using namespace std::string_view_literals;
+
+
+namespace enumgen::tests
+{
+    namespace
+    {
+
+        void expectEveryKeyInOwnSlot(std::vector<std::string_view> const & keys, PerfectHash const & hash)
+        {
+            ASSERT_EQ(hash.slots.size(), keys.size());
+
+            for (auto index = 0ul; index < keys.size(); ++index)
+            {
+                auto slot = perfectHashSlot(fnv1a(keys[index]), hash.seeds, hash.slots.size());
+                EXPECT_EQ(hash.slots[slot], index) << keys[index];
+            }
+        }
+
+    }  // namespace
+
+
+    TEST(PerfectHashTests, buildPerfectHash_WhenNoKeys_ReturnsEmptyTable)
+    {
+        // Act
+        auto hash = buildPerfectHash({});
+
+        // Assert
+        EXPECT_TRUE(hash.seeds.empty());
+        EXPECT_TRUE(hash.slots.empty());
+    }
+
+    TEST(PerfectHashTests, buildPerfectHash_WhenSingleKey_MapsToOnlySlot)
+    {
+        // Arrange
+        auto keys = std::vector{ "Quiet"sv };
+
+        // Act
+        auto hash = buildPerfectHash(keys);
+
+        // Assert
+        expectEveryKeyInOwnSlot(keys, hash);
+    }
+
+    TEST(PerfectHashTests, buildPerfectHash_MapsEveryKeyToOwnSlot)
+    {
+        // Arrange
+        auto keys = std::vector{ "Quite"sv, "quite"sv, "QUITE"sv, "Minimal"sv, "Normal"sv, "NORMAL"sv, "normal"sv };
+
+        // Act
+        auto hash = buildPerfectHash(keys);
+
+        // Assert
+        expectEveryKeyInOwnSlot(keys, hash);
+        EXPECT_LE(hash.seeds.size(), keys.size());
+    }
+
+    TEST(PerfectHashTests, buildPerfectHash_WhenManyKeys_MapsEveryKeyToOwnSlot)
+    {
+        // Arrange
+        auto strings = std::vector<std::string>();
+        for (auto index = 0ul; index < 1000ul; ++index)
+        {
+            strings.push_back("Value" + std::to_string(index));
+        }
+
+        auto keys = std::vector<std::string_view>(strings.begin(), strings.end());
+
+        // Act
+        auto hash = buildPerfectHash(keys);
+
+        // Assert
+        expectEveryKeyInOwnSlot(keys, hash);
+    }
+
+    TEST(PerfectHashTests, buildPerfectHash_IsDeterministic)
+    {
+        // Arrange
+        auto keys = std::vector{ "Detailed"sv, "Diagnostic"sv, "Minimal"sv, "Normal"sv, "Quiet"sv };
+
+        // Act
+        auto first = buildPerfectHash(keys);
+        auto second = buildPerfectHash(keys);
+
+        // Assert
+        EXPECT_EQ(first.seeds, second.seeds);
+        EXPECT_EQ(first.slots, second.slots);
+    }
+
+    TEST(PerfectHashTests, buildPerfectHash_WhenDuplicateKeys_Throws)
+    {
+        // Arrange
+        auto keys = std::vector{ "Normal"sv, "Quiet"sv, "Normal"sv };
+
+        // Act & Assert
+        EXPECT_THROW(static_cast<void>(buildPerfectHash(keys)), std::runtime_error);
+    }
+
+}  // namespace enumgen::tests
\ No newline at end of file
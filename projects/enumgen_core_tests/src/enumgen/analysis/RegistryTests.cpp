@@ -0,0 +1,121 @@
+#include <enumgen/analysis/Registry.hpp>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+
+using namespace nlohmann;
+
+
+namespace enumgen::tests
+{
+    namespace
+    {
+
+        std::vector<std::string> names(json const & entries)
+        {
+            auto result = std::vector<std::string>();
+            for (auto const & entry : entries)
+            {
+                result.push_back(entry["name"].get<std::string>());
+            }
+
+            return result;
+        }
+
+    }  // namespace
+
+
+    TEST(RegistryTests, makeRegistryEnum_QualifiesNameAndResolvesValues)
+    {
+        // Arrange
+        auto description = json::parse(R"({
+            "name": "Verbosity",
+            "namespace": "example",
+            "items": [ { "name": "Quiet" }, { "name": "Loud", "value": 5 }, { "name": "Louder" } ]
+        })");
+
+        // Act
+        auto result = makeRegistryEnum(description);
+
+        // Assert
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result->name, "example::Verbosity");
+        ASSERT_EQ(result->items.size(), 3ul);
+        EXPECT_EQ(result->items[0].value, 0);
+        EXPECT_EQ(result->items[1].value, 5);
+        EXPECT_EQ(result->items[2].value, 6);
+    }
+
+    TEST(RegistryTests, makeRegistryEnum_WhenValueOutOfRange_ReturnsNothing)
+    {
+        // Arrange
+        auto description = json::parse(R"({
+            "name": "Big",
+            "namespace": "example",
+            "items": [ { "name": "Huge", "value": 18446744073709551615 } ]
+        })");
+
+        // Act
+        auto result = makeRegistryEnum(description);
+
+        // Assert
+        EXPECT_FALSE(result.has_value());
+    }
+
+    TEST(RegistryTests, analyzeRegistry_SortsEnumsByNameAndItemsByName)
+    {
+        // Arrange
+        auto enums = std::vector<RegistryEnum>{
+            RegistryEnum{ "example::Verbosity", { { "Quiet", 0 }, { "Loud", 1 } } },
+            RegistryEnum{ "example::Colour", { { "Red", 0 }, { "Green", 1 }, { "Blue", 2 } } },
+        };
+
+        // Act
+        auto registry = analyzeRegistry(enums);
+
+        // Assert
+        EXPECT_EQ(names(registry["enums"]), (std::vector<std::string>{ "example::Colour", "example::Verbosity" }));
+        EXPECT_EQ(names(registry["items"]), (std::vector<std::string>{ "Blue", "Green", "Red", "Loud", "Quiet" }));
+
+        auto const & verbosity = registry["enums"][1];
+        EXPECT_EQ(verbosity["itemsOffset"], 3);
+        EXPECT_EQ(verbosity["itemCount"], 2);
+    }
+
+    TEST(RegistryTests, analyzeRegistry_Values_SortedByValueKeepingFirstItemOfEachValue)
+    {
+        // Arrange
+        auto enums = std::vector<RegistryEnum>{
+            RegistryEnum{ "example::Level", { { "High", 2 }, { "Low", -1 }, { "Top", 2 }, { "Min", 0 } } },
+        };
+
+        // Act
+        auto registry = analyzeRegistry(enums);
+
+        // Assert
+        EXPECT_EQ(names(registry["values"]), (std::vector<std::string>{ "Low", "Min", "High" }));
+        EXPECT_EQ(registry["values"][0]["value"], "-1LL");
+        EXPECT_EQ(registry["enums"][0]["valueCount"], 3);
+    }
+
+    TEST(RegistryTests, analyzeRegistry_WhenSmallestValue_WritesExpression)
+    {
+        // Arrange
+        auto enums = std::vector<RegistryEnum>{
+            RegistryEnum{ "example::Limits", { { "Min", std::numeric_limits<std::int64_t>::min() } } },
+        };
+
+        // Act
+        auto registry = analyzeRegistry(enums);
+
+        // Assert
+        EXPECT_EQ(registry["items"][0]["value"], "(-9223372036854775807LL - 1)");
+    }
+
+}  // namespace enumgen::tests
\ No newline at end of file
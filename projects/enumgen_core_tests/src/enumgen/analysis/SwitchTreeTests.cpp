@@ -0,0 +1,143 @@
+#include <enumgen/analysis/SwitchTree.hpp>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+
+using namespace std::string_view_literals;
+
+
+namespace enumgen::tests
+{
+    namespace
+    {
+
+        using Kind = SwitchNode::Kind;
+
+        /// <summary>
+        /// Walks the tree as generated code would, returns the index of the key matched for the string if any
+        /// </summary>
+        std::optional<std::size_t> lookup(
+            std::vector<SwitchNode> const & nodes, std::span<std::string_view const> keys, std::string_view str)
+        {
+            auto index = 0ul;
+            while (index < nodes.size())
+            {
+                auto const & node = nodes[index];
+                if (node.kind != Kind::Switch)
+                {
+                    return std::nullopt;
+                }
+
+                auto label = node.value == SwitchNode::lengthPosition
+                                 ? str.size()
+                                 : (node.value < str.size() ? static_cast<unsigned char>(str[node.value]) : 256ul);
+
+                // Cases directly inside the switch share its depth, the switch ends at the End with the same depth
+                auto depth = node.depth;
+                auto isCase = [&](SwitchNode const & other) {
+                    return other.kind == Kind::Case && other.depth == depth && other.value == label;
+                };
+
+                for (++index; index < nodes.size() && !isCase(nodes[index]); ++index)
+                {
+                    if (nodes[index].kind == Kind::End && nodes[index].depth == depth)
+                    {
+                        return std::nullopt;
+                    }
+                }
+
+                ++index;
+
+                if (nodes[index].kind == Kind::Match)
+                {
+                    auto key = nodes[index].value;
+                    return keys[key] == str ? std::optional(key) : std::nullopt;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+    }  // namespace
+
+
+    TEST(SwitchTreeTests, buildSwitchTree_WhenNoKeys_ReturnsEmptyTree)
+    {
+        // Act & Assert
+        EXPECT_TRUE(buildSwitchTree({}).empty());
+    }
+
+    TEST(SwitchTreeTests, buildSwitchTree_WhenLengthsDistinct_SwitchesOnLengthOnly)
+    {
+        // Arrange
+        auto keys = std::vector{ "Quiet"sv, "Loud"sv };
+
+        // Act
+        auto nodes = buildSwitchTree(keys);
+
+        // Assert
+        auto expected = std::vector<Kind>{ Kind::Switch, Kind::Case, Kind::Match, Kind::Break,
+                                           Kind::Case,   Kind::Match, Kind::Break, Kind::End };
+        ASSERT_EQ(nodes.size(), expected.size());
+        for (auto index = 0ul; index < nodes.size(); ++index)
+        {
+            EXPECT_EQ(nodes[index].kind, expected[index]);
+        }
+
+        EXPECT_EQ(nodes[0].value, SwitchNode::lengthPosition);
+        EXPECT_EQ(nodes[1].value, 4ul);
+        EXPECT_EQ(nodes[2].value, 1ul);
+        EXPECT_EQ(nodes[4].value, 5ul);
+        EXPECT_EQ(nodes[5].value, 0ul);
+    }
+
+    TEST(SwitchTreeTests, buildSwitchTree_SwitchesOnMostDistinguishingPosition)
+    {
+        // Arrange
+        auto keys = std::vector{ "abX1"sv, "abY2"sv, "abZ3"sv };
+
+        // Act
+        auto nodes = buildSwitchTree(keys);
+
+        // Assert
+        ASSERT_GE(nodes.size(), 3ul);
+        EXPECT_EQ(nodes[2].kind, Kind::Switch);
+        EXPECT_EQ(nodes[2].depth, 1ul);
+        EXPECT_EQ(nodes[2].value, 2ul);
+    }
+
+    TEST(SwitchTreeTests, buildSwitchTree_ResolvesEveryKey)
+    {
+        // Arrange
+        auto keys = std::vector{ "Quite"sv,  "quite"sv,  "QUITE"sv,    "Minimal"sv,    "Normal"sv,
+                                 "NORMAL"sv, "normal"sv, "Detailed"sv, "Diagnostic"sv, "N"sv };
+
+        // Act
+        auto nodes = buildSwitchTree(keys);
+
+        // Assert
+        for (auto index = 0ul; index < keys.size(); ++index)
+        {
+            EXPECT_EQ(lookup(nodes, keys, keys[index]), index) << keys[index];
+        }
+
+        EXPECT_EQ(lookup(nodes, keys, "Nirmal"sv), std::nullopt);
+        EXPECT_EQ(lookup(nodes, keys, ""sv), std::nullopt);
+    }
+
+    TEST(SwitchTreeTests, buildSwitchTree_WhenDuplicateKeys_Throws)
+    {
+        // Arrange
+        auto keys = std::vector{ "Normal"sv, "Normal"sv };
+
+        // Act & Assert
+        EXPECT_THROW(static_cast<void>(buildSwitchTree(keys)), std::runtime_error);
+    }
+
+}  // namespace enumgen::tests
\ No newline at end of file
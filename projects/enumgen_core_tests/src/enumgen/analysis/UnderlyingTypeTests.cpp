@@ -0,0 +1,56 @@
+#include <enumgen/analysis/UnderlyingType.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+
+using namespace std::string_view_literals;
+
+
+namespace enumgen::tests
+{
+
+    TEST(UnderlyingTypeTests, findUnderlyingType_WhenKnown_ReturnsRange)
+    {
+        // Act
+        auto type = findUnderlyingType("unsigned short"sv);
+
+        // Assert
+        ASSERT_TRUE(type.has_value());
+        EXPECT_EQ(type->min, 0);
+        EXPECT_EQ(type->max, 65535u);
+    }
+
+    TEST(UnderlyingTypeTests, findUnderlyingType_WhenUnknown_ReturnsNothing)
+    {
+        // Act & Assert
+        EXPECT_FALSE(findUnderlyingType("example::Integer"sv).has_value());
+    }
+
+    TEST(UnderlyingTypeTests, narrowestUnderlyingType_WhenNoNegatives_ReturnsUnsigned)
+    {
+        // Arrange
+        auto values = std::vector<std::int64_t>{ 0, 255, 7 };
+
+        // Act & Assert
+        EXPECT_EQ(narrowestUnderlyingType(values).name, "std::uint8_t");
+    }
+
+    TEST(UnderlyingTypeTests, narrowestUnderlyingType_WhenNegative_ReturnsSigned)
+    {
+        // Arrange
+        auto values = std::vector<std::int64_t>{ -1, 200 };
+
+        // Act & Assert
+        EXPECT_EQ(narrowestUnderlyingType(values).name, "std::int16_t");
+    }
+
+    TEST(UnderlyingTypeTests, narrowestUnderlyingType_WhenEmpty_ReturnsNarrowestUnsigned)
+    {
+        // Act & Assert
+        EXPECT_EQ(narrowestUnderlyingType({}).name, "std::uint8_t");
+    }
+
+}  // namespace enumgen::tests
\ No newline at end of file
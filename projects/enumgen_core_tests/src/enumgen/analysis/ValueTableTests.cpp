@@ -0,0 +1,137 @@
+#include <enumgen/analysis/ValueTable.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+
+namespace enumgen::tests
+{
+    namespace
+    {
+
+        std::vector<std::int64_t> entryValues(ValueTable const & table)
+        {
+            auto values = std::vector<std::int64_t>();
+            for (auto const & entry : table.entries)
+            {
+                values.push_back(entry.value);
+            }
+
+            return values;
+        }
+
+        std::vector<std::optional<std::size_t>> entryItems(ValueTable const & table)
+        {
+            auto items = std::vector<std::optional<std::size_t>>();
+            for (auto const & entry : table.entries)
+            {
+                items.push_back(entry.item);
+            }
+
+            return items;
+        }
+
+    }  // namespace
+
+
+    TEST(ValueTableTests, buildValueTable_WhenContiguousFromZero_IsDense)
+    {
+        // Arrange
+        auto values = std::vector<std::int64_t>{ 2, 0, 1 };
+
+        // Act
+        auto table = buildValueTable(values);
+
+        // Assert
+        EXPECT_EQ(table.layout, ValueLayout::Dense);
+        EXPECT_EQ(entryValues(table), (std::vector<std::int64_t>{ 0, 1, 2 }));
+        EXPECT_EQ(entryItems(table), (std::vector<std::optional<std::size_t>>{ 1ul, 2ul, 0ul }));
+    }
+
+    TEST(ValueTableTests, buildValueTable_WhenContiguousFromOffset_IsOffsetDense)
+    {
+        // Arrange
+        auto values = std::vector<std::int64_t>{ -2, -1, 0, 1 };
+
+        // Act
+        auto table = buildValueTable(values);
+
+        // Assert
+        EXPECT_EQ(table.layout, ValueLayout::OffsetDense);
+        EXPECT_EQ(entryValues(table), (std::vector<std::int64_t>{ -2, -1, 0, 1 }));
+    }
+
+    TEST(ValueTableTests, buildValueTable_WhenHolesAtMostHalf_FillsHoles)
+    {
+        // Arrange
+        auto values = std::vector<std::int64_t>{ 10, 12, 14, 15 };
+
+        // Act
+        auto table = buildValueTable(values);
+
+        // Assert
+        EXPECT_EQ(table.layout, ValueLayout::OffsetDense);
+        EXPECT_EQ(
+            entryItems(table),
+            (std::vector<std::optional<std::size_t>>{ 0ul, std::nullopt, 1ul, std::nullopt, 2ul, 3ul }));
+    }
+
+    TEST(ValueTableTests, buildValueTable_WhenSpreadOut_IsSparseAndSorted)
+    {
+        // Arrange
+        auto values = std::vector<std::int64_t>{ 1, 100, -1000, 7 };
+
+        // Act
+        auto table = buildValueTable(values);
+
+        // Assert
+        EXPECT_EQ(table.layout, ValueLayout::Sparse);
+        EXPECT_EQ(entryValues(table), (std::vector<std::int64_t>{ -1000, 1, 7, 100 }));
+        EXPECT_EQ(entryItems(table), (std::vector<std::optional<std::size_t>>{ 2ul, 0ul, 3ul, 1ul }));
+    }
+
+    TEST(ValueTableTests, buildValueTable_WhenValuesShared_FirstItemWins)
+    {
+        // Arrange
+        auto values = std::vector<std::int64_t>{ 0, 1, 1, 2 };
+
+        // Act
+        auto table = buildValueTable(values);
+
+        // Assert
+        EXPECT_EQ(table.layout, ValueLayout::Dense);
+        EXPECT_EQ(entryItems(table), (std::vector<std::optional<std::size_t>>{ 0ul, 1ul, 3ul }));
+    }
+
+    TEST(ValueTableTests, buildValueTable_WhenFullRange_IsSparse)
+    {
+        // Arrange
+        auto values = std::vector<std::int64_t>{ std::numeric_limits<std::int64_t>::min(),
+                                                 std::numeric_limits<std::int64_t>::max() };
+
+        // Act
+        auto table = buildValueTable(values);
+
+        // Assert
+        EXPECT_EQ(table.layout, ValueLayout::Sparse);
+        EXPECT_EQ(table.entries.size(), 2ul);
+    }
+
+    TEST(ValueTableTests, valueDistance_WhenFullRange_DoesNotOverflow)
+    {
+        // Arrange
+        auto min = std::numeric_limits<std::int64_t>::min();
+        auto max = std::numeric_limits<std::int64_t>::max();
+
+        // Act
+        auto distance = valueDistance(max, min);
+
+        // Assert
+        EXPECT_EQ(distance, std::numeric_limits<std::uint64_t>::max());
+    }
+
+}  // namespace enumgen::tests
\ No newline at end of file
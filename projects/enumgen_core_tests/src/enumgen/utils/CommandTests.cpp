@@ -15,12 +15,14 @@ namespace enumgen::tests
             std::string_view valueWithDefault;
             bool flag;
             bool flagWithDefault;
+            std::size_t count;
 
             static constexpr auto parameters = parametersFor<TestCommand>(
                 Parameter<&TestCommand::value>("-v", "--value"),
                 Parameter<&TestCommand::valueWithDefault>("-w", "--valueWithDefault", "default"),
                 Parameter<&TestCommand::flag>("-f", "--flag"),
-                Parameter<&TestCommand::flagWithDefault>("-g", "--flagWithDefault", true));
+                Parameter<&TestCommand::flagWithDefault>("-g", "--flagWithDefault", true),
+                Parameter<&TestCommand::count>("-n", "--count", 1ul));
         };
 
         static_assert(std::default_initializable<TestCommand>);
@@ -83,4 +85,35 @@ namespace enumgen::tests
         EXPECT_EQ(result->flagWithDefault, false);
     }
 
+    TEST(CommandTests, parseCommand_WithNumber)
+    {
+        // Arrange
+        const auto args = createArgs({ "-v"sv, "value"sv, "--count"sv, "42"sv });
+        auto preprocessed = preprocess(args.argc, args.argv);
+        auto tokens = Tokens(0, std::span{ preprocessed });
+
+        // Act
+        const auto result = parseCommand<TestCommand>(tokens);
+
+        // Assert
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result->value, "value"sv);
+        EXPECT_EQ(result->count, 42ul);
+    }
+
+    TEST(CommandTests, parseCommand_WithInvalidNumber)
+    {
+        // Arrange
+        const auto args = createArgs({ "-v"sv, "value"sv, "--count"sv, "4x"sv });
+        auto preprocessed = preprocess(args.argc, args.argv);
+        auto tokens = Tokens(0, std::span{ preprocessed });
+
+        // Act
+        const auto result = parseCommand<TestCommand>(tokens);
+
+        // Assert
+        ASSERT_FALSE(result);
+        EXPECT_EQ(result.error().error, "Unable to convert value"sv);
+    }
+
 }  // namespace enumgen::tests
\ No newline at end of file
@@ -0,0 +1,224 @@
+#include <enumgen/utils/Files.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+
+using namespace std::filesystem;
+using namespace std::string_view_literals;
+
+
+namespace enumgen::tests
+{
+    namespace
+    {
+
+        class FilesTests : public ::testing::Test
+        {
+        protected:
+            path directory;
+            path file;
+
+            void SetUp() override
+            {
+                directory = temp_directory_path() / "enumgen_files_tests";
+                remove_all(directory);
+                create_directories(directory);
+
+                file = directory / "Verbosity.h";
+            }
+
+            void TearDown() override
+            {
+                remove_all(directory);
+            }
+
+            std::string readFile() const
+            {
+                auto stream = std::ifstream(file, std::ios::in | std::ios::binary);
+                auto buffer = std::stringstream();
+                buffer << stream.rdbuf();
+                return buffer.str();
+            }
+        };
+
+    }  // namespace
+
+
+    TEST_F(FilesTests, writeIfChanged_WhenFileMissing_Writes)
+    {
+        // Act
+        auto result = writeIfChanged(file, "content"sv);
+
+        // Assert
+        EXPECT_EQ(result, WriteResult::Written);
+        EXPECT_EQ(readFile(), "content");
+    }
+
+    TEST_F(FilesTests, writeIfChanged_WhenContentSame_PreservesFile)
+    {
+        // Arrange
+        std::ignore = writeIfChanged(file, "content"sv);
+        auto previousWriteTime = last_write_time(file) - std::chrono::hours(1);
+        last_write_time(file, previousWriteTime);
+
+        // Act
+        auto result = writeIfChanged(file, "content"sv);
+
+        // Assert
+        EXPECT_EQ(result, WriteResult::Unchanged);
+        EXPECT_EQ(last_write_time(file), previousWriteTime);
+    }
+
+    TEST_F(FilesTests, writeIfChanged_WhenContentDiffersWithSameSize_Writes)
+    {
+        // Arrange
+        std::ignore = writeIfChanged(file, "content"sv);
+
+        // Act
+        auto result = writeIfChanged(file, "CONTENT"sv);
+
+        // Assert
+        EXPECT_EQ(result, WriteResult::Written);
+        EXPECT_EQ(readFile(), "CONTENT");
+    }
+
+    TEST_F(FilesTests, writeIfChanged_LeavesNoTemporaryFiles)
+    {
+        // Act
+        std::ignore = writeIfChanged(file, "content"sv);
+        std::ignore = writeIfChanged(file, "changed content"sv);
+
+        // Assert
+        auto count = std::distance(directory_iterator(directory), directory_iterator());
+        EXPECT_EQ(count, 1);
+    }
+
+    TEST_F(FilesTests, fileContentEquals_WhenFileMissing_ReturnsFalse)
+    {
+        // Act & Assert
+        EXPECT_FALSE(fileContentEquals(file, ""sv));
+    }
+
+    TEST_F(FilesTests, writeStats_RecordsResults)
+    {
+        // Arrange
+        auto stats = WriteStats{};
+
+        // Act
+        stats.record(WriteResult::Written);
+        stats.record(WriteResult::Unchanged);
+        stats.record(WriteResult::Unchanged);
+
+        // Assert
+        EXPECT_EQ(stats.written, 1ul);
+        EXPECT_EQ(stats.unchanged, 2ul);
+    }
+
+    TEST_F(FilesTests, isWithin_ComparesLexically)
+    {
+        // Act & Assert
+        EXPECT_TRUE(isWithin(path("out/src/Verbosity.cpp"), path("out")));
+        EXPECT_TRUE(isWithin(path("out/./src/../include/Verbosity.h"), path("out")));
+        EXPECT_FALSE(isWithin(path("out/../Verbosity.h"), path("out")));
+        EXPECT_FALSE(isWithin(path("out"), path("out")));
+        EXPECT_FALSE(isWithin(path("other/Verbosity.h"), path("out")));
+    }
+
+    TEST_F(FilesTests, removeFileAndEmptyParents_RemovesEmptyDirectoriesUpToRoot)
+    {
+        // Arrange
+        auto nested = directory / "src" / "example" / "Verbosity.cpp";
+        create_directories(nested.parent_path());
+        std::ignore = writeIfChanged(nested, "content"sv);
+
+        // Act
+        auto result = removeFileAndEmptyParents(nested, directory);
+
+        // Assert
+        EXPECT_TRUE(result);
+        EXPECT_FALSE(exists(directory / "src"));
+        EXPECT_TRUE(exists(directory));
+    }
+
+    TEST_F(FilesTests, removeFileAndEmptyParents_KeepsNonEmptyDirectories)
+    {
+        // Arrange
+        auto removed = directory / "src" / "example" / "Verbosity.cpp";
+        auto kept = directory / "src" / "Level.cpp";
+        create_directories(removed.parent_path());
+        std::ignore = writeIfChanged(removed, "content"sv);
+        std::ignore = writeIfChanged(kept, "content"sv);
+
+        // Act
+        std::ignore = removeFileAndEmptyParents(removed, directory);
+
+        // Assert
+        EXPECT_FALSE(exists(directory / "src" / "example"));
+        EXPECT_TRUE(exists(kept));
+    }
+
+    TEST_F(FilesTests, removeFileAndEmptyParents_WhenFileMissing_ReturnsFalse)
+    {
+        // Act & Assert
+        EXPECT_FALSE(removeFileAndEmptyParents(file, directory));
+    }
+
+    TEST_F(FilesTests, mappedFile_WhenSmall_ReadsContent)
+    {
+        // Arrange
+        std::ignore = writeIfChanged(file, "content"sv);
+
+        // Act
+        auto mapped = MappedFile(file);
+
+        // Assert
+        EXPECT_FALSE(mapped.mapped());
+        EXPECT_EQ(mapped.view(), "content"sv);
+    }
+
+    TEST_F(FilesTests, mappedFile_WhenLarge_MapsContent)
+    {
+        // Arrange
+        auto content = std::string(MappedFile::mapThreshold + 17ul, 'x');
+        content.back() = 'y';
+        std::ignore = writeIfChanged(file, content);
+
+        // Act
+        auto mapped = MappedFile(file);
+
+        // Assert
+        EXPECT_TRUE(mapped.mapped());
+        EXPECT_EQ(mapped.view(), content);
+    }
+
+    TEST_F(FilesTests, mappedFile_WhenMoved_TransfersContent)
+    {
+        // Arrange
+        auto content = std::string(MappedFile::mapThreshold, 'x');
+        std::ignore = writeIfChanged(file, content);
+        auto mapped = MappedFile(file);
+
+        // Act
+        auto moved = std::move(mapped);
+
+        // Assert
+        EXPECT_TRUE(moved.mapped());
+        EXPECT_EQ(moved.view(), content);
+        EXPECT_TRUE(mapped.view().empty());
+    }
+
+    TEST_F(FilesTests, mappedFile_WhenFileMissing_Throws)
+    {
+        // Act & Assert
+        EXPECT_THROW(MappedFile(directory / "missing.json"), std::runtime_error);
+    }
+
+}  // namespace enumgen::tests
\ No newline at end of file
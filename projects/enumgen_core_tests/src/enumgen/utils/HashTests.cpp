@@ -0,0 +1,42 @@
+#include <enumgen/utils/Hash.hpp>
+
+#include <gtest/gtest.h>
+
+
+using namespace std::string_view_literals;
+
+
+namespace enumgen::tests
+{
+
+    TEST(HashTests, fnv1a_MatchesReferenceValues)
+    {
+        static_assert(fnv1a(""sv) == 0xcbf29ce484222325ull);
+
+        EXPECT_EQ(fnv1a(""sv), 0xcbf29ce484222325ull);
+        EXPECT_EQ(fnv1a("a"sv), 0xaf63dc4c8601ec8cull);
+        EXPECT_EQ(fnv1a("foobar"sv), 0x85944171f73967e8ull);
+    }
+
+    TEST(HashTests, hasher_IsDeterministic)
+    {
+        // Arrange
+        auto hash = [] {
+            return Hasher().update("Verbosity"sv).update(42ul).digest();
+        };
+
+        // Act & Assert
+        EXPECT_EQ(hash(), hash());
+    }
+
+    TEST(HashTests, hasher_FieldBoundariesAffectHash)
+    {
+        // Act
+        auto first = Hasher().update("ab"sv).update("c"sv).digest();
+        auto second = Hasher().update("a"sv).update("bc"sv).digest();
+
+        // Assert
+        EXPECT_NE(first, second);
+    }
+
+}  // namespace enumgen::tests
\ No newline at end of file
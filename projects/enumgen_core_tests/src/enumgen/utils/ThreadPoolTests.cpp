@@ -0,0 +1,85 @@
+#include <enumgen/utils/ThreadPool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+
+namespace enumgen::tests
+{
+
+    TEST(ThreadPoolTests, submit_RunsAllTasks)
+    {
+        // Arrange
+        auto results = std::vector<int>(1000ul, 0);
+        auto pool = ThreadPool(4ul);
+
+        // Act
+        for (auto index = 0ul; index < results.size(); ++index)
+        {
+            pool.submit([&results, index](std::size_t) { results[index] = static_cast<int>(index); });
+        }
+
+        pool.wait();
+
+        // Assert
+        for (auto index = 0ul; index < results.size(); ++index)
+        {
+            EXPECT_EQ(results[index], static_cast<int>(index));
+        }
+    }
+
+    TEST(ThreadPoolTests, submit_PassesWorkerIndexInRange)
+    {
+        // Arrange
+        auto outOfRange = std::atomic<int>(0);
+        auto pool = ThreadPool(3ul);
+
+        // Act
+        for (auto index = 0ul; index < 100ul; ++index)
+        {
+            pool.submit([&](std::size_t workerIndex) {
+                if (workerIndex >= pool.size())
+                {
+                    ++outOfRange;
+                }
+            });
+        }
+
+        pool.wait();
+
+        // Assert
+        EXPECT_EQ(pool.size(), 3ul);
+        EXPECT_EQ(outOfRange.load(), 0);
+    }
+
+    TEST(ThreadPoolTests, wait_RethrowsTaskException)
+    {
+        // Arrange
+        auto completed = std::atomic<int>(0);
+        auto pool = ThreadPool(2ul);
+
+        // Act
+        pool.submit([](std::size_t) { throw std::runtime_error("task failed"); });
+        for (auto index = 0ul; index < 10ul; ++index)
+        {
+            pool.submit([&](std::size_t) { ++completed; });
+        }
+
+        // Assert
+        EXPECT_THROW(pool.wait(), std::runtime_error);
+        EXPECT_EQ(completed.load(), 10);
+    }
+
+    TEST(ThreadPoolTests, wait_WithNoTasks_Returns)
+    {
+        // Arrange
+        auto pool = ThreadPool(2ul);
+
+        // Act & Assert
+        EXPECT_NO_THROW(pool.wait());
+    }
+
+}  // namespace enumgen::tests
\ No newline at end of file